@@ -0,0 +1,123 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Common support for host benchmarks
+ * @details     Each benchmark accepts an optional iteration count as its first
+ *              argument, so ctest can run it briefly while a manual run can
+ *              use a larger count.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "arch/compiler.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Return the current time of CLOCK_MONOTONIC in nanoseconds
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS uint64_t benchTimeNs(
+    void) {
+
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+}
+
+/**@brief       Return the CPU time used by the process in nanoseconds
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS uint64_t benchCpuTimeNs(
+    void) {
+
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+}
+
+/**@brief       Return the iteration count given on the command line
+ * @param       argc
+ *              Argument count passed to main()
+ * @param       argv
+ *              Arguments passed to main()
+ * @param       def
+ *              Count used when no argument is given
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS uint32_t benchCount(
+    int             argc,
+    char **         argv,
+    uint32_t        def) {
+
+    uint32_t        count;
+
+    count = def;
+
+    if (1 < argc) {
+        count = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    return (count);
+}
+
+/**@brief       Prevent the compiler from removing a computation
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void benchKeep(
+    uintptr_t       value) {
+
+    __asm__ __volatile__("" : : "r" (value) : "memory");
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of bench.h
+ ******************************************************************************/
+#endif /* BENCH_H_ */
@@ -0,0 +1,179 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Batched versus per-event dispatch
+ * @details     A source EPA object posts bursts of events to a sink EPA object.
+ *              The sink asks for the next burst after it has handled the last
+ *              event of the current one, so its queue always holds a full
+ *              burst. The program is built with OPT_KERNEL_DISPATCH_BATCH set
+ *              to 1, 8 and 16 and reports the time per dispatched event.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define BURST_SIZE                      32U
+#define SIG_BURST                       (SIG_ID_USR + 1U)
+#define SIG_WORK                        (SIG_ID_USR + 2U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T sourceState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T sinkState(
+    void *          sm,
+    esEvt_T *       evt);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esEpa_T * Source;
+
+static esEpa_T * Sink;
+
+static uint32_t Dispatched;
+
+static uint32_t EvtNum;
+
+static uint64_t StartTime;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T sourceState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_BURST == evt->id) {
+        uint32_t    cnt;
+
+        for (cnt = 0U; cnt < BURST_SIZE; cnt++) {
+            esEvtPost(
+                Sink,
+                esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_WORK));
+        }
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+static esStatus_T sinkState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_WORK == evt->id) {
+        Dispatched++;
+
+        if (EvtNum <= Dispatched) {
+            uint64_t time;
+
+            time = benchTimeNs() - StartTime;
+            (void)printf("dispatch_batch: batch=%u events=%u time=%.3f ms dispatch=%.1f ns\n",
+                (unsigned)OPT_KERNEL_DISPATCH_BATCH,
+                Dispatched,
+                (double)time / 1e6,
+                (double)time / (double)Dispatched);
+            exit(EXIT_SUCCESS);
+        }
+
+        if (0U == (Dispatched % BURST_SIZE)) {
+            esEvtPost(
+                Source,
+                esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_BURST));
+        }
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T sourceDef = {
+        .epaName          = "source",
+        .epaPrio          = 2U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 4U,
+        .smInitState      = sourceState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    static const esEpaDef_T sinkDef = {
+        .epaName          = "sink",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 2U * BURST_SIZE,
+        .smInitState      = sinkState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+
+    EvtNum = benchCount(argc, argv, 5000000U);
+    esKernelInit();
+    Source = esEpaCreate(
+        &esMemDynClass,
+        &sourceDef);
+    Sink = esEpaCreate(
+        &esMemDynClass,
+        &sinkDef);
+    esEvtPost(
+        Source,
+        esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_BURST));
+    StartTime = benchTimeNs();
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of dispatch_batch.c
+ ******************************************************************************/
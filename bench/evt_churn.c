@@ -0,0 +1,181 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Event allocation latency over long churn
+ * @details     A window of WINDOW_SIZE live events is churned by replacing a
+ *              random event with a new one of random size. Small events come
+ *              from the registered pools and large events, or events which do
+ *              not fit into a full pool, come from the heap. The run is split
+ *              into EPOCH_NUM epochs and the average and worst create latency
+ *              of each epoch is printed, so a latency which drifts as the run
+ *              gets longer is visible. At the end all events are destroyed and
+ *              the program fails if a pool did not get all its blocks back.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define POOL_NUM                        3U
+#define POOL_BLOCKS                     256U
+#define POOL_SIZE_MAX                   128U
+#define EVT_SIZE_MAX                    512U
+#define WINDOW_SIZE                     1024U
+#define EPOCH_NUM                       10U
+#define SIG_DATA                        (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const size_t PoolSize[POOL_NUM] = {
+    32U,
+    64U,
+    POOL_SIZE_MAX
+};
+
+static esPMemHandle_T Pool[POOL_NUM];
+
+static uint8_t PoolStorage[POOL_NUM][POOL_BLOCKS * POOL_SIZE_MAX];
+
+static size_t PoolFree[POOL_NUM];
+
+static esEvt_T * Window[WINDOW_SIZE];
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    uint32_t        iterNum;
+    uint32_t        epochSize;
+    uint32_t        epoch;
+    uint32_t        seed;
+    uint32_t        cnt;
+    int             result;
+
+    iterNum = benchCount(argc, argv, 20000000U);
+    epochSize = iterNum / EPOCH_NUM;
+
+    if (0U == epochSize) {
+        epochSize = 1U;
+    }
+    esKernelInit();
+
+    for (cnt = 0U; cnt < POOL_NUM; cnt++) {
+        esPMemInit(
+            &Pool[cnt],
+            PoolStorage[cnt],
+            POOL_BLOCKS * PoolSize[cnt],
+            PoolSize[cnt]);
+        PoolFree[cnt] = Pool[cnt].nFree;
+        esEvtPoolRegister(
+            &Pool[cnt]);
+    }
+    seed = 1U;
+
+    for (cnt = 0U; cnt < WINDOW_SIZE; cnt++) {
+        Window[cnt] = esEvtCreate(
+            sizeof(esEvt_T),
+            (esEvtId_T)SIG_DATA);
+    }
+
+    for (epoch = 0U; epoch < EPOCH_NUM; epoch++) {
+        uint64_t    total;
+        uint64_t    worst;
+
+        total = 0U;
+        worst = 0U;
+
+        for (cnt = 0U; cnt < epochSize; cnt++) {
+            uint32_t    slot;
+            size_t      size;
+            uint64_t    startTime;
+            uint64_t    time;
+
+            seed = seed * 1103515245U + 12345U;
+            slot = (seed >> 8U) % WINDOW_SIZE;
+            seed = seed * 1103515245U + 12345U;
+            size = sizeof(esEvt_T) + ((seed >> 8U) % (EVT_SIZE_MAX - sizeof(esEvt_T) + 1U));
+            esEvtDestroy(
+                Window[slot]);
+            startTime = benchTimeNs();
+            Window[slot] = esEvtCreate(
+                size,
+                (esEvtId_T)SIG_DATA);
+            time = benchTimeNs() - startTime;
+            total += time;
+
+            if (worst < time) {
+                worst = time;
+            }
+        }
+        (void)printf("evt_churn: epoch=%u events=%u create=%.1f ns worst=%.1f us\n",
+            epoch,
+            epochSize,
+            (double)total / (double)epochSize,
+            (double)worst / 1e3);
+    }
+
+    for (cnt = 0U; cnt < WINDOW_SIZE; cnt++) {
+        esEvtDestroy(
+            Window[cnt]);
+    }
+    result = EXIT_SUCCESS;
+
+    for (cnt = 0U; cnt < POOL_NUM; cnt++) {
+
+        if (PoolFree[cnt] != Pool[cnt].nFree) {
+            (void)printf("evt_churn: pool %u has %u free blocks, expected %u\n",
+                cnt,
+                (unsigned)Pool[cnt].nFree,
+                (unsigned)PoolFree[cnt]);
+            result = EXIT_FAILURE;
+        }
+    }
+
+    return (result);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (0 != CFG_EVT_STORAGE)
+# error "evt_churn: benchmark requires pool and heap event storage (CFG_EVT_STORAGE 0)."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of evt_churn.c
+ ******************************************************************************/
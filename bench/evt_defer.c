@@ -0,0 +1,304 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Dispatches saved by the deferred event queue
+ * @details     A driver EPA object feeds a worker EPA object with a random mix
+ *              of requests and ticks, one new event for each event the worker
+ *              handles. The worker is idle or busy. A request moves an idle
+ *              worker to busy, and a busy worker defers it until BUSY_TICKS
+ *              ticks have passed and it is idle again, where it recalls the
+ *              deferred requests. The second argument is the size of the
+ *              deferred event queue: 0 re-posts a deferred event at once, as
+ *              before the queue existed. The program reports how many times
+ *              the worker was dispatched to serve the given number of requests
+ *              and the statistics of the deferred event queue.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define BUSY_TICKS                      4U
+#define REQ_RATIO                       8U                                      /* One event in REQ_RATIO is a request, which keeps the     */
+                                                                                /* worker busy a bit more than half of the time.            */
+#define SIG_STEP                        (SIG_ID_USR + 1U)
+#define SIG_REQ                         (SIG_ID_USR + 2U)
+#define SIG_TICK                        (SIG_ID_USR + 3U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+
+struct worker {
+    esEpa_T         epa;
+    uint32_t        ticks;
+};
+
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T driverState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T workerInit(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T workerIdle(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T workerBusy(
+    void *          sm,
+    esEvt_T *       evt);
+
+static void workerDone(
+    void);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esEpa_T * Driver;
+
+static struct worker * Worker;
+
+static uint32_t Seed;
+
+static uint32_t Dispatched;
+
+static uint32_t Served;
+
+static uint32_t ReqNum;
+
+static uint64_t StartTime;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T driverState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_STEP == evt->id) {
+        esEvtId_T   id;
+
+        Seed = Seed * 1103515245U + 12345U;
+        id = (esEvtId_T)SIG_TICK;
+
+        if (0U == ((Seed >> 8U) % REQ_RATIO)) {
+            id = (esEvtId_T)SIG_REQ;
+        }
+        esEvtPost(
+            &Worker->epa,
+            esEvtCreate(sizeof(esEvt_T), id));
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+static esStatus_T workerInit(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    status = ES_STATE_IGNORED();
+
+    if (SIG_INIT == evt->id) {
+        status = ES_STATE_TRAN(sm, workerIdle);
+    }
+
+    return (status);
+}
+
+static esStatus_T workerIdle(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    switch (evt->id) {
+        case SIG_ENTRY : {
+            (void)esEvtRecall(
+                &((struct worker *)sm)->epa);
+            status = ES_STATE_HANDLED();
+            break;
+        }
+
+        case SIG_REQ : {
+            Served++;
+            workerDone();
+            status = ES_STATE_TRAN(sm, workerBusy);
+            break;
+        }
+
+        case SIG_TICK : {
+            workerDone();
+            status = ES_STATE_HANDLED();
+            break;
+        }
+
+        default : {
+            status = ES_STATE_IGNORED();
+            break;
+        }
+    }
+
+    return (status);
+}
+
+static esStatus_T workerBusy(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    struct worker * worker;
+    esStatus_T      status;
+
+    worker = (struct worker *)sm;
+
+    switch (evt->id) {
+        case SIG_ENTRY : {
+            worker->ticks = 0U;
+            status = ES_STATE_HANDLED();
+            break;
+        }
+
+        case SIG_REQ : {
+            workerDone();
+            status = RETN_DEFERRED;
+            break;
+        }
+
+        case SIG_TICK : {
+            workerDone();
+            worker->ticks++;
+            status = ES_STATE_HANDLED();
+
+            if (BUSY_TICKS == worker->ticks) {
+                status = ES_STATE_TRAN(sm, workerIdle);
+            }
+            break;
+        }
+
+        default : {
+            status = ES_STATE_IGNORED();
+            break;
+        }
+    }
+
+    return (status);
+}
+
+static void workerDone(
+    void) {
+
+    Dispatched++;
+
+    if (ReqNum == Served) {
+        esEpaDeferStatus_T status;
+        uint64_t    time;
+
+        time = benchTimeNs() - StartTime;
+        esEpaDeferStatusGet(
+            &Worker->epa,
+            &status);
+        (void)printf("evt_defer: requests=%u dispatches=%u time=%.3f ms deferred=%u recalled=%u overflow=%u saved=%u\n",
+            ReqNum,
+            Dispatched,
+            (double)time / 1e6,
+            status.deferred,
+            status.recalled,
+            status.overflow,
+            status.saved);
+        exit(EXIT_SUCCESS);
+    }
+    esEvtPost(
+        Driver,
+        esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_STEP));
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T driverDef = {
+        .epaName          = "driver",
+        .epaPrio          = 2U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 4U,
+        .smInitState      = driverState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    esEpaDef_T      workerDef = {
+        .epaName          = "worker",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(struct worker),
+        .evtQueueLevels   = 64U,
+        .smInitState      = workerInit,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+
+    ReqNum = benchCount(argc, argv, 100000U);
+    workerDef.evtDeferLevels = 16U;
+
+    if (2 < argc) {
+        workerDef.evtDeferLevels = (size_t)strtoul(argv[2], NULL, 0);
+    }
+    esKernelInit();
+    Driver = esEpaCreate(
+        &esMemDynClass,
+        &driverDef);
+    Worker = (struct worker *)esEpaCreate(
+        &esMemDynClass,
+        &workerDef);
+    Seed = 1U;
+    esEvtPost(
+        Driver,
+        esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_STEP));
+    StartTime = benchTimeNs();
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of evt_defer.c
+ ******************************************************************************/
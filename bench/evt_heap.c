@@ -0,0 +1,241 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Dynamic event storage: TLSF against the heap
+ * @details     A window of WINDOW_SIZE live events of random size between
+ *              sizeof(esEvt_T) and EVT_SIZE_MAX is churned by replacing a
+ *              random event with a new one. The program reports the average
+ *              and worst time of one destroy and create pair. It is built with
+ *              the TLSF allocator behind OPT_MEM_DYN_HANDLE, with the default
+ *              dynamic allocator and with glibc malloc (CFG_EVT_STORAGE 3).
+ *              The same churn is then repeated with direct calls of the
+ *              allocator, without the critical section of the event API, which
+ *              on the POSIX port costs more than the allocators themselves.
+ *              With TLSF the fragmentation at the end of the run is reported
+ *              too.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+#if (1U == OPT_MEM_DYN_TLSF)
+# include "eds/tlsf.h"
+#endif
+
+/*===============================================================  DEFINES  ==*/
+
+#define EVT_SIZE_MAX                    512U
+#define WINDOW_SIZE                     1024U
+#define TLSF_STORAGE_SIZE               ((size_t)1U << OPT_MEM_TLSF_FL_MAX)
+#define SIG_DATA                        (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+#if (3 == CFG_EVT_STORAGE)
+# define RAW_ALLOC(size)                malloc(size)
+# define RAW_DEALLOC(mem)               free(mem)
+#else
+# define RAW_ALLOC(size)                OPT_MEM_DYN_ALLOCI(OPT_MEM_DYN_HANDLE, size)
+# define RAW_DEALLOC(mem)               OPT_MEM_DYN_DEALLOCI(OPT_MEM_DYN_HANDLE, mem)
+#endif
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static void churnRaw(
+    uint32_t        iterNum,
+    const char *    name);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+#if (1U == OPT_MEM_DYN_TLSF)
+static uint64_t TlsfStorage[TLSF_STORAGE_SIZE / sizeof(uint64_t)];
+#endif
+
+static esEvt_T * Window[WINDOW_SIZE];
+
+static void * RawWindow[WINDOW_SIZE];
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static void churnRaw(
+    uint32_t        iterNum,
+    const char *    name) {
+
+    uint32_t        seed;
+    uint32_t        cnt;
+    uint64_t        total;
+    uint64_t        worst;
+
+    seed = 1U;
+
+    for (cnt = 0U; cnt < WINDOW_SIZE; cnt++) {
+        RawWindow[cnt] = RAW_ALLOC(sizeof(esEvt_T));
+    }
+    total = 0U;
+    worst = 0U;
+
+    for (cnt = 0U; cnt < iterNum; cnt++) {
+        uint32_t    slot;
+        size_t      size;
+        uint64_t    startTime;
+        uint64_t    time;
+
+        seed = seed * 1103515245U + 12345U;
+        slot = (seed >> 8U) % WINDOW_SIZE;
+        seed = seed * 1103515245U + 12345U;
+        size = sizeof(esEvt_T) + ((seed >> 8U) % (EVT_SIZE_MAX - sizeof(esEvt_T) + 1U));
+        startTime = benchTimeNs();
+        RAW_DEALLOC(RawWindow[slot]);
+        RawWindow[slot] = RAW_ALLOC(size);
+        time = benchTimeNs() - startTime;
+        total += time;
+
+        if (worst < time) {
+            worst = time;
+        }
+    }
+
+    for (cnt = 0U; cnt < WINDOW_SIZE; cnt++) {
+        RAW_DEALLOC(RawWindow[cnt]);
+    }
+    (void)printf("evt_heap: allocator=%s iterations=%u raw free+alloc=%.1f ns worst=%.1f us\n",
+        name,
+        iterNum,
+        (double)total / (double)iterNum,
+        (double)worst / 1e3);
+}
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const char * const allocator[] = {
+        "heap",
+        "tlsf",
+        "malloc"
+    };
+    uint32_t        iterNum;
+    uint32_t        seed;
+    uint32_t        cnt;
+    uint64_t        total;
+    uint64_t        worst;
+    const char *    name;
+
+    iterNum = benchCount(argc, argv, 5000000U);
+    name = allocator[(3 == CFG_EVT_STORAGE) ? 2U : OPT_MEM_DYN_TLSF];
+
+    if (0U == iterNum) {
+
+        return (EXIT_FAILURE);
+    }
+#if (1U == OPT_MEM_DYN_TLSF)
+    esTlsfInit(
+        &DefTlsfHandle,
+        TlsfStorage,
+        sizeof(TlsfStorage));
+#endif
+    esKernelInit();
+    seed = 1U;
+
+    for (cnt = 0U; cnt < WINDOW_SIZE; cnt++) {
+        Window[cnt] = esEvtCreate(
+            sizeof(esEvt_T),
+            (esEvtId_T)SIG_DATA);
+    }
+    total = 0U;
+    worst = 0U;
+
+    for (cnt = 0U; cnt < iterNum; cnt++) {
+        uint32_t    slot;
+        size_t      size;
+        uint64_t    startTime;
+        uint64_t    time;
+
+        seed = seed * 1103515245U + 12345U;
+        slot = (seed >> 8U) % WINDOW_SIZE;
+        seed = seed * 1103515245U + 12345U;
+        size = sizeof(esEvt_T) + ((seed >> 8U) % (EVT_SIZE_MAX - sizeof(esEvt_T) + 1U));
+        startTime = benchTimeNs();
+        esEvtDestroy(
+            Window[slot]);
+        Window[slot] = esEvtCreate(
+            size,
+            (esEvtId_T)SIG_DATA);
+        time = benchTimeNs() - startTime;
+        total += time;
+
+        if (worst < time) {
+            worst = time;
+        }
+    }
+    (void)printf("evt_heap: allocator=%s iterations=%u destroy+create=%.1f ns worst=%.1f us",
+        name,
+        iterNum,
+        (double)total / (double)iterNum,
+        (double)worst / 1e3);
+#if (1U == OPT_MEM_DYN_TLSF)
+    {
+        esTlsfStatus_T status;
+
+        esTlsfStatusGet(
+            &DefTlsfHandle,
+            &status);
+        (void)printf(" free=%u blocks=%u fragmentation=%u permille",
+            (unsigned)status.freeSize,
+            (unsigned)status.freeBlocks,
+            (unsigned)status.fragmentation);
+    }
+#endif
+    (void)printf("\n");
+
+    for (cnt = 0U; cnt < WINDOW_SIZE; cnt++) {
+        esEvtDestroy(
+            Window[cnt]);
+    }
+    churnRaw(
+        iterNum,
+        name);
+
+    return (EXIT_SUCCESS);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (2 > CFG_EVT_STORAGE)
+# error "evt_heap: benchmark requires dynamic event storage (CFG_EVT_STORAGE 2 or 3)."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of evt_heap.c
+ ******************************************************************************/
@@ -0,0 +1,232 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Event magazine hit rate and create-post-destroy throughput
+ * @details     Tokens travel between EPA objects spread over all kernel CPUs.
+ *              Each dispatch creates a new event of one of the pool sizes and
+ *              posts it to the next EPA object, and the dispatcher destroys the
+ *              handled event, so every dispatch is one full create, post,
+ *              dispatch and destroy cycle. The program is built with and
+ *              without magazines, with the locked and the lock-free pool, on
+ *              one and on four CPUs. Only the lock-free pool lets the magazine
+ *              path skip the critical section. The program reports the
+ *              throughput and, with magazines, the hit rate of all CPUs.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define EPA_NUM                         16U
+#define TOKEN_NUM                       4U
+#define POOL_NUM                        3U
+#define POOL_BLOCKS                     256U
+#define SIG_TOKEN                       (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+#if (1U == OPT_MEM_POOL_LOCKFREE)
+# define POOL_INIT(pool, storage, storageSize, blockSize)                       \
+    esLfPoolInit_(pool, storage, storageSize, blockSize)
+#else
+# define POOL_INIT(pool, storage, storageSize, blockSize)                       \
+    esPMemInit(pool, storage, storageSize, blockSize)
+#endif
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+
+struct node {
+    esEpa_T         epa;
+    uint32_t        next;
+    uint32_t        seed;
+};
+
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static void report(
+    void);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const size_t PoolSize[POOL_NUM] = {
+    sizeof(esEvt_T),
+    sizeof(esEvt_T) + 32U,
+    sizeof(esEvt_T) + 96U
+};
+
+static OPT_MEM_POOL_T Pool[POOL_NUM];
+
+static uint8_t PoolStorage[POOL_NUM][POOL_BLOCKS * (sizeof(esEvt_T) + 96U)];
+
+static struct node * Node[EPA_NUM];
+
+static atomic_uint_fast32_t Dispatched;
+
+static uint32_t EvtNum;
+
+static uint64_t StartTime;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    struct node *   node;
+    esStatus_T      status;
+
+    node = (struct node *)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_TOKEN == evt->id) {
+        node->seed = node->seed * 1103515245U + 12345U;
+        node->next = (node->next + 5U) % EPA_NUM;
+        esEvtPost(
+            &Node[node->next]->epa,
+            esEvtCreate(PoolSize[(node->seed >> 8U) % POOL_NUM], (esEvtId_T)SIG_TOKEN));
+
+        if (EvtNum == (atomic_fetch_add(&Dispatched, 1U) + 1U)) {
+            report();
+            exit(EXIT_SUCCESS);
+        }
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+static void report(
+    void) {
+
+    uint64_t        time;
+
+    time = benchTimeNs() - StartTime;
+    (void)printf("evt_mag: cpus=%u lockfree=%u mag=%u events=%u time=%.3f ms throughput=%.0f events/s",
+        (unsigned)OPT_KERNEL_CPU_NUM,
+        (unsigned)OPT_MEM_POOL_LOCKFREE,
+        (unsigned)CFG_EVT_MAG_SIZE,
+        EvtNum,
+        (double)time / 1e6,
+        (double)EvtNum * 1e9 / (double)time);
+#if (0 != CFG_EVT_MAG_SIZE)
+    {
+        esEvtMagStatus_T cpuStatus;
+        uint64_t    hit;
+        uint64_t    miss;
+        uint_fast8_t cpu;
+
+        hit  = 0U;
+        miss = 0U;
+
+        for (cpu = 0U; cpu < OPT_KERNEL_CPU_NUM; cpu++) {
+            esEvtMagStatusGet(
+                cpu,
+                &cpuStatus);
+            hit  += (uint64_t)cpuStatus.allocHit  + cpuStatus.freeHit;
+            miss += (uint64_t)cpuStatus.allocMiss + cpuStatus.freeMiss;
+        }
+        (void)printf(" hit=%.2f %%",
+            100.0 * (double)hit / (double)(hit + miss));
+    }
+#endif
+    (void)printf("\n");
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T definition = {
+        .epaName          = "node",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(struct node),
+        .evtQueueLevels   = 2U * TOKEN_NUM * EPA_NUM,
+        .smInitState      = nodeState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    uint32_t        cnt;
+
+    EvtNum = benchCount(argc, argv, 2000000U);
+    esKernelInit();
+
+    for (cnt = 0U; cnt < POOL_NUM; cnt++) {
+        POOL_INIT(
+            &Pool[cnt],
+            PoolStorage[cnt],
+            POOL_BLOCKS * PoolSize[cnt],
+            PoolSize[cnt]);
+        esEvtPoolRegister(
+            &Pool[cnt]);
+    }
+
+    for (cnt = 0U; cnt < EPA_NUM; cnt++) {
+        esEpaDef_T  def;
+
+        def = definition;
+        def.epaPrio = (uint16_t)(1U + (cnt % 4U));
+        def.epaCpu = (uint8_t)(cnt % OPT_KERNEL_CPU_NUM);
+        Node[cnt] = (struct node *)esEpaCreate(
+            &esMemDynClass,
+            &def);
+        Node[cnt]->next = cnt;
+        Node[cnt]->seed = cnt;
+    }
+
+    for (cnt = 0U; cnt < (TOKEN_NUM * EPA_NUM); cnt++) {
+        esEvtPost(
+            &Node[cnt % EPA_NUM]->epa,
+            esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_TOKEN));
+    }
+    StartTime = benchTimeNs();
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (1 != CFG_EVT_STORAGE)
+# error "evt_mag: benchmark requires pool only event storage (CFG_EVT_STORAGE 1)."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of evt_mag.c
+ ******************************************************************************/
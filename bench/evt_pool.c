@@ -0,0 +1,150 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Event create and destroy throughput with many event pools
+ * @details     The first argument is the iteration count and the second one is
+ *              the number of registered pools, 1 to POOL_MAX. Pool block sizes
+ *              are spread evenly between POOL_SIZE_MIN and POOL_SIZE_MAX. Each
+ *              iteration destroys one event from a window of live events and
+ *              creates a new one of random size in its place. The program is
+ *              built with the size class table and with a table which covers
+ *              no size, so that every lookup searches the pool list.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define POOL_MAX                        CFG_EVT_STORAGE_NPOOL
+#define POOL_BLOCKS                     64U
+#define POOL_SIZE_MIN                   16U
+#define POOL_SIZE_MAX                   128U
+#define WINDOW_SIZE                     16U
+#define SIG_DATA                        (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esPMemHandle_T Pool[POOL_MAX];
+
+static uint8_t PoolStorage[POOL_MAX][POOL_BLOCKS * POOL_SIZE_MAX];
+
+static esEvt_T * Window[WINDOW_SIZE];
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    uint32_t        iterNum;
+    uint32_t        poolNum;
+    uint32_t        seed;
+    uint32_t        cnt;
+    uint64_t        startTime;
+    uint64_t        time;
+
+    iterNum = benchCount(argc, argv, 2000000U);
+    poolNum = 2U;
+
+    if (2 < argc) {
+        poolNum = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+
+    if ((0U == poolNum) || (POOL_MAX < poolNum)) {
+        (void)printf("evt_pool: pool count must be in range 1 - %u\n",
+            (unsigned)POOL_MAX);
+
+        return (EXIT_FAILURE);
+    }
+    esKernelInit();
+
+    for (cnt = 0U; cnt < poolNum; cnt++) {
+        size_t      blockSize;
+
+        blockSize = POOL_SIZE_MAX;
+
+        if (1U < poolNum) {
+            blockSize = POOL_SIZE_MIN + ((POOL_SIZE_MAX - POOL_SIZE_MIN) * cnt) / (poolNum - 1U);
+        }
+        esPMemInit(
+            &Pool[cnt],
+            PoolStorage[cnt],
+            sizeof(PoolStorage[cnt]),
+            blockSize);
+        esEvtPoolRegister(
+            &Pool[cnt]);
+    }
+    seed = 1U;
+
+    for (cnt = 0U; cnt < WINDOW_SIZE; cnt++) {
+        Window[cnt] = esEvtCreate(
+            sizeof(esEvt_T),
+            (esEvtId_T)SIG_DATA);
+    }
+    startTime = benchTimeNs();
+
+    for (cnt = 0U; cnt < iterNum; cnt++) {
+        size_t      size;
+
+        seed = seed * 1103515245U + 12345U;
+        size = sizeof(esEvt_T) + ((seed >> 8U) % (POOL_SIZE_MAX - sizeof(esEvt_T) + 1U));
+        esEvtDestroy(
+            Window[cnt % WINDOW_SIZE]);
+        Window[cnt % WINDOW_SIZE] = esEvtCreate(
+            size,
+            (esEvtId_T)SIG_DATA);
+    }
+    time = benchTimeNs() - startTime;
+    (void)printf("evt_pool: class_max=%u pools=%u iterations=%u time=%.3f ms create+destroy=%.1f ns\n",
+        (unsigned)CFG_EVT_STORAGE_CLASS_MAX,
+        poolNum,
+        iterNum,
+        (double)time / 1e6,
+        (double)time / (double)iterNum);
+
+    return (EXIT_SUCCESS);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (1 != CFG_EVT_STORAGE)
+# error "evt_pool: benchmark requires pool only event storage (CFG_EVT_STORAGE 1)."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of evt_pool.c
+ ******************************************************************************/
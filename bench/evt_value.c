@@ -0,0 +1,202 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Small events posted by value against heap events
+ * @details     Tokens which carry one machine word travel between EPA_NUM EPA
+ *              objects. Each dispatch reads the payload and posts it, plus
+ *              one, to the next EPA object. With the second argument 0 tokens
+ *              are heap events created with esEvtCreate(), with 1 they are
+ *              posted by value with esEvtPostValue(). The first argument is
+ *              the dispatch count.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define EPA_NUM                         4U
+#define TOKEN_NUM                       8U
+#define SIG_TOKEN                       (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+
+struct tokenEvt {
+    esEvt_T         evt;
+    uintptr_t       value;
+};
+
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static void tokenPost(
+    esEpa_T *       epa,
+    uintptr_t       value);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esEpa_T * Node[EPA_NUM];
+
+static bool_T IsByValue;
+
+static uint32_t Dispatched;
+
+static uint32_t EvtNum;
+
+static uintptr_t Sum;
+
+static uint64_t StartTime;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_TOKEN == evt->id) {
+        uintptr_t   value;
+
+        if (TRUE == IsByValue) {
+            value = ES_EVT_VALUE_GET(evt);
+        } else {
+            value = ((const struct tokenEvt *)evt)->value;
+        }
+        Sum += value;
+        tokenPost(
+            Node[value % EPA_NUM],
+            value + 1U);
+        Dispatched++;
+
+        if (EvtNum == Dispatched) {
+            uint64_t time;
+
+            time = benchTimeNs() - StartTime;
+            benchKeep(Sum);
+            (void)printf("evt_value: events=%s dispatched=%u time=%.3f ms dispatch=%.1f ns\n",
+                (TRUE == IsByValue) ? "value" : "heap",
+                EvtNum,
+                (double)time / 1e6,
+                (double)time / (double)EvtNum);
+            exit(EXIT_SUCCESS);
+        }
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+static void tokenPost(
+    esEpa_T *       epa,
+    uintptr_t       value) {
+
+    if (TRUE == IsByValue) {
+        esEvtPostValue(
+            epa,
+            (esEvtId_T)SIG_TOKEN,
+            value);
+    } else {
+        struct tokenEvt * evt;
+
+        evt = (struct tokenEvt *)esEvtCreate(
+            sizeof(struct tokenEvt),
+            (esEvtId_T)SIG_TOKEN);
+        evt->value = value;
+        esEvtPost(
+            epa,
+            &evt->evt);
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T definition = {
+        .epaName          = "node",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 2U * TOKEN_NUM,
+        .smInitState      = nodeState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    uint32_t        cnt;
+
+    EvtNum = benchCount(argc, argv, 2000000U);
+    IsByValue = FALSE;
+
+    if ((2 < argc) && (0UL != strtoul(argv[2], NULL, 0))) {
+        IsByValue = TRUE;
+    }
+    esKernelInit();
+
+    for (cnt = 0U; cnt < EPA_NUM; cnt++) {
+        esEpaDef_T  def;
+
+        def = definition;
+        def.epaPrio = (uint16_t)(1U + cnt);
+        Node[cnt] = esEpaCreate(
+            &esMemDynClass,
+            &def);
+    }
+
+    for (cnt = 0U; cnt < TOKEN_NUM; cnt++) {
+        tokenPost(
+            Node[cnt % EPA_NUM],
+            cnt);
+    }
+    StartTime = benchTimeNs();
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (1U != OPT_KERNEL_EVT_VALUE)
+# error "evt_value: benchmark requires value events (OPT_KERNEL_EVT_VALUE 1)."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of evt_value.c
+ ******************************************************************************/
@@ -0,0 +1,224 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Event posting under contention from producer threads
+ * @details     Each producer thread posts events to its own EPA object, so the
+ *              producers never share a queue. The first argument is the total
+ *              event count and the second one is the number of producer
+ *              threads, 1 to 16. The program is built with the locked and the
+ *              lock-free event queue and reports the time per posted event and
+ *              how often a producer found the queue full.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define PRODUCER_MAX                    16U
+#define SIG_WORK                        (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T consumerState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static void * producer(
+    void *          arg);
+
+static void * coordinator(
+    void *          arg);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esEpa_T * Consumer[PRODUCER_MAX];
+
+static atomic_uint Dispatched;
+
+static atomic_uint Full;
+
+static atomic_uint Started;
+
+static uint32_t ProducerNum;
+
+static uint32_t EvtNum;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T consumerState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_WORK == evt->id) {
+        atomic_fetch_add_explicit(&Dispatched, 1U, memory_order_relaxed);
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+static void * producer(
+    void *          arg) {
+
+    esEpa_T *       consumer;
+    uint32_t        cnt;
+    uint32_t        full;
+
+    consumer = (esEpa_T *)arg;
+    full = 0U;
+    atomic_fetch_add(&Started, 1U);
+
+    while (ProducerNum != atomic_load(&Started)) {
+        sched_yield();
+    }
+
+    for (cnt = 0U; cnt < (EvtNum / ProducerNum); cnt++) {
+        esEvt_T *   evt;
+
+        evt = esEvtCreate(
+            sizeof(esEvt_T),
+            (esEvtId_T)SIG_WORK);
+
+        while (EVT_POST_OK != esEvtTryPost(consumer, evt)) {
+            full++;
+            sched_yield();
+        }
+    }
+    atomic_fetch_add(&Full, full);
+
+    return (NULL);
+}
+
+static void * coordinator(
+    void *          arg) {
+
+    pthread_t       thread[PRODUCER_MAX];
+    uint32_t        total;
+    uint32_t        cnt;
+    uint64_t        startTime;
+    uint64_t        time;
+
+    (void)arg;
+    total = (EvtNum / ProducerNum) * ProducerNum;
+    startTime = benchTimeNs();
+
+    for (cnt = 0U; cnt < ProducerNum; cnt++) {
+        (void)pthread_create(&thread[cnt], NULL, producer, Consumer[cnt]);
+    }
+
+    for (cnt = 0U; cnt < ProducerNum; cnt++) {
+        (void)pthread_join(thread[cnt], NULL);
+    }
+
+    while (total != atomic_load(&Dispatched)) {
+        sched_yield();
+    }
+    time = benchTimeNs() - startTime;
+    (void)printf("evtq_contention: lockfree=%u producers=%u events=%u time=%.3f ms post=%.1f ns full=%u\n",
+        (unsigned)OPT_KERNEL_EVTQ_LOCKFREE,
+        ProducerNum,
+        total,
+        (double)time / 1e6,
+        (double)time / (double)total,
+        atomic_load(&Full));
+    exit(EXIT_SUCCESS);
+
+    return (NULL);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T definition = {
+        .epaName          = "consumer",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 256U,
+        .smInitState      = consumerState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    pthread_t       thread;
+    uint32_t        cnt;
+
+    EvtNum = benchCount(argc, argv, 2000000U);
+    ProducerNum = 1U;
+
+    if (2 < argc) {
+        ProducerNum = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+
+    if ((0U == ProducerNum) || (PRODUCER_MAX < ProducerNum)) {
+        (void)printf("evtq_contention: producer count must be in range 1 - %u\n",
+            PRODUCER_MAX);
+
+        return (EXIT_FAILURE);
+    }
+    esKernelInit();
+
+    for (cnt = 0U; cnt < PRODUCER_MAX; cnt++) {
+        esEpaDef_T  def;
+
+        def = definition;
+        def.epaPrio = (uint16_t)(1U + (cnt % 4U));
+        def.epaCpu = (uint8_t)(cnt % OPT_KERNEL_CPU_NUM);
+        Consumer[cnt] = esEpaCreate(
+            &esMemDynClass,
+            &def);
+    }
+    atomic_init(&Dispatched, 0U);
+    atomic_init(&Full, 0U);
+    atomic_init(&Started, 0U);
+    (void)pthread_create(&thread, NULL, coordinator, NULL);
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of evtq_contention.c
+ ******************************************************************************/
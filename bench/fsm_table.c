@@ -0,0 +1,287 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Table driven FSM against switch based state handlers
+ * @details     The same flat state machine is written twice: as a transition
+ *              table for @ref ES_SMP_FSM_TABLE and as state functions with a
+ *              switch on the event identifier for @ref ES_SMP_FSM_ONLY. The
+ *              engine is chosen by the kernel library the program is linked
+ *              against. The machine has STATE_NUM states and SIGNAL_NUM
+ *              signals. Every signal runs an action, and all signals but the
+ *              first one move the machine to another state. The first argument
+ *              is the dispatch count. The signals are taken from a fixed
+ *              pseudo random sequence. The program reports the time per
+ *              dispatch and checks that every dispatch ran the action.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define STATE_NUM                       4U
+#define SIGNAL_NUM                      4U
+#define SEQ_SIZE                        1024U
+
+#define SIG_STAY                        (SIG_ID_USR + 0U)
+#define SIG_STEP1                       (SIG_ID_USR + 1U)
+#define SIG_STEP2                       (SIG_ID_USR + 2U)
+#define SIG_STEP3                       (SIG_ID_USR + 3U)
+#define SIG_LAST                        (SIG_ID_USR + SIGNAL_NUM)
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)
+# define ENGINE_NAME                    "table"
+#else
+# define ENGINE_NAME                    "switch"
+#endif
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+#define SWITCH_STATE(state)                                                     \
+    static esStatus_T switchState ## state(                                     \
+        void *          sm,                                                     \
+        esEvt_T *       evt) {                                                  \
+                                                                                \
+        esStatus_T      status;                                                 \
+                                                                                \
+        switch (evt->id) {                                                      \
+            case SIG_STAY : {                                                   \
+                countAction(sm, evt);                                           \
+                status = ES_STATE_HANDLED();                                    \
+                break;                                                          \
+            }                                                                   \
+                                                                                \
+            case SIG_STEP1 : {                                                  \
+                countAction(sm, evt);                                           \
+                status = ES_STATE_TRAN(sm, States[((state) + 1U) % STATE_NUM]); \
+                break;                                                          \
+            }                                                                   \
+                                                                                \
+            case SIG_STEP2 : {                                                  \
+                countAction(sm, evt);                                           \
+                status = ES_STATE_TRAN(sm, States[((state) + 2U) % STATE_NUM]); \
+                break;                                                          \
+            }                                                                   \
+                                                                                \
+            case SIG_STEP3 : {                                                  \
+                countAction(sm, evt);                                           \
+                status = ES_STATE_TRAN(sm, States[((state) + 3U) % STATE_NUM]); \
+                break;                                                          \
+            }                                                                   \
+                                                                                \
+            default : {                                                         \
+                status = ES_STATE_IGNORED();                                    \
+                break;                                                          \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return (status);                                                        \
+    }
+
+#define TABLE_ROW(state)                                                        \
+    ES_SM_TABLE_ROW(state) {                                                    \
+        ES_SM_TABLE_ACTION(SIG_STAY, &countAction),                             \
+        ES_SM_TABLE_TRAN(SIG_STEP1, &countAction, ((state) + 1U) % STATE_NUM),  \
+        ES_SM_TABLE_TRAN(SIG_STEP2, &countAction, ((state) + 2U) % STATE_NUM),  \
+        ES_SM_TABLE_TRAN(SIG_STEP3, &countAction, ((state) + 3U) % STATE_NUM)   \
+    }
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static void countAction(
+    void *          sm,
+    const esEvt_T * evt);
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
+static esStatus_T initState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T switchState0(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T switchState1(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T switchState2(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T switchState3(
+    void *          sm,
+    esEvt_T *       evt);
+#endif
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static uint32_t ActionNum;
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
+static const esState_T States[STATE_NUM] = {
+    switchState0,
+    switchState1,
+    switchState2,
+    switchState3
+};
+#else
+ES_SM_TABLE_BEGIN(Table, STATE_NUM, SIG_LAST)
+    TABLE_ROW(0U),
+    TABLE_ROW(1U),
+    TABLE_ROW(2U),
+    TABLE_ROW(3U)
+ES_SM_TABLE_END(Table, STATE_NUM, SIG_LAST, 0U);
+#endif
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static void countAction(
+    void *          sm,
+    const esEvt_T * evt) {
+
+    (void)sm;
+    (void)evt;
+    ActionNum++;
+}
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
+static esStatus_T initState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    if (SIG_INIT == evt->id) {
+        status = ES_STATE_TRAN(sm, switchState0);
+    } else {
+        status = ES_STATE_IGNORED();
+    }
+
+    return (status);
+}
+
+SWITCH_STATE(0)
+
+SWITCH_STATE(1)
+
+SWITCH_STATE(2)
+
+SWITCH_STATE(3)
+#endif
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static esEvt_T  evt[SIGNAL_NUM];
+    static uint8_t  seq[SEQ_SIZE];
+    esSmDef_T       definition = {
+        .smWorkspaceSize  = sizeof(esSm_T),
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
+        .smInitState      = initState,
+        .smLevels         = 2U
+#else
+        .smTable          = &Table
+#endif
+    };
+    esSm_T *        sm;
+    uint32_t        dispatchNum;
+    uint32_t        cnt;
+    uint64_t        startTime;
+    uint64_t        time;
+
+    dispatchNum = benchCount(argc, argv, 10000000U);
+
+    for (cnt = 0U; cnt < SIGNAL_NUM; cnt++) {
+        evt[cnt].id = (esEvtId_T)(SIG_STAY + cnt);
+    }
+    srand(1U);
+
+    for (cnt = 0U; cnt < SEQ_SIZE; cnt++) {
+        seq[cnt] = (uint8_t)((uint32_t)rand() % SIGNAL_NUM);
+    }
+    esSmpInit();
+    sm = esSmCreate(
+        &esMemDynClass,
+        &definition);
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
+    {
+        static const esEvt_T initEvt = {
+            .id = (esEvtId_T)SIG_INIT
+        };
+
+        (void)esSmDispatch(
+            sm,
+            &initEvt);
+    }
+#endif
+    ActionNum = 0U;
+    startTime = benchTimeNs();
+
+    for (cnt = 0U; cnt < dispatchNum; cnt++) {
+        (void)esSmDispatch(
+            sm,
+            &evt[seq[cnt % SEQ_SIZE]]);
+    }
+    time = benchTimeNs() - startTime;
+    (void)printf("fsm_table: engine=%s dispatches=%u time=%.3f ms dispatch=%.1f ns actions=%u\n",
+        ENGINE_NAME,
+        dispatchNum,
+        (double)time / 1e6,
+        (double)time / (double)dispatchNum,
+        ActionNum);
+    esSmDestroy(
+        sm);
+
+    if (ActionNum != dispatchNum) {
+        (void)printf("fsm_table: %u dispatches did not run the action\n",
+            dispatchNum - ActionNum);
+
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (OPT_SMP_SM_TYPES != ES_SMP_FSM_ONLY) && (OPT_SMP_SM_TYPES != ES_SMP_FSM_TABLE)
+# error "fsm_table: benchmark requires flat state machines, switch or table based."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of fsm_table.c
+ ******************************************************************************/
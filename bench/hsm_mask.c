@@ -0,0 +1,270 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       HSM handler calls skipped by the handled signal masks
+ * @details     The state machine is a chain of DEPTH states described by a
+ *              state hierarchy table, and it rests in the deepest one. Three
+ *              signals are dispatched in turn: SIG_LEAF is handled by the leaf
+ *              state, SIG_ROOT by the outermost state, and SIG_NONE by no
+ *              state at all. Every state publishes the signals it handles with
+ *              ES_SM_STATE_MASK(). The program is built against a kernel with
+ *              @ref OPT_SMP_STATE_MASK turned on and against one with it turned
+ *              off. For each signal it reports the time per dispatch, the
+ *              handler calls per dispatch and the handler calls the dispatcher
+ *              skipped per dispatch. The first argument is the dispatch count
+ *              per signal.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define DEPTH                           8U
+#define SIG_LEAF                        (SIG_ID_USR + 0U)
+#define SIG_ROOT                        (SIG_ID_USR + 1U)
+#define SIG_NONE                        (SIG_ID_USR + 2U)
+#define SIGNAL_NUM                      3U
+
+#define LEVEL_MASK                                                              \
+    (ES_SM_SIG(SIG_ENTRY) | ES_SM_SIG(SIG_EXIT) | ES_SM_SIG(SIG_INIT))
+
+#if (1U == OPT_SMP_STATE_MASK)
+# define MASK_NAME                      "on"
+#else
+# define MASK_NAME                      "off"
+#endif
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+#define CHAIN_STATE(level)                                                      \
+    static esStatus_T chainState ## level(                                      \
+        void *          sm,                                                     \
+        esEvt_T *       evt) {                                                  \
+                                                                                \
+        return (chainState(sm, evt, level));                                    \
+    }
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T chainState(
+    void *          sm,
+    const esEvt_T * evt,
+    uint_fast8_t    level);
+
+static esStatus_T initState(
+    void *          sm,
+    esEvt_T *       evt);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static uint32_t HandlerCalls;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+CHAIN_STATE(1)
+
+CHAIN_STATE(2)
+
+CHAIN_STATE(3)
+
+CHAIN_STATE(4)
+
+CHAIN_STATE(5)
+
+CHAIN_STATE(6)
+
+CHAIN_STATE(7)
+
+CHAIN_STATE(8)
+
+ES_SM_STATE_TABLE_BEGIN(StateTable)
+    ES_SM_STATE_MASK(&chainState1, ES_SM_TOP_IDX, 1U, LEVEL_MASK | ES_SM_SIG(SIG_ROOT)),
+    ES_SM_STATE_MASK(&chainState2, 1U, 2U, LEVEL_MASK),
+    ES_SM_STATE_MASK(&chainState3, 2U, 3U, LEVEL_MASK),
+    ES_SM_STATE_MASK(&chainState4, 3U, 4U, LEVEL_MASK),
+    ES_SM_STATE_MASK(&chainState5, 4U, 5U, LEVEL_MASK),
+    ES_SM_STATE_MASK(&chainState6, 5U, 6U, LEVEL_MASK),
+    ES_SM_STATE_MASK(&chainState7, 6U, 7U, LEVEL_MASK),
+    ES_SM_STATE_MASK(&chainState8, 7U, 8U, LEVEL_MASK | ES_SM_SIG(SIG_LEAF)),
+    ES_SM_STATE_MASK(&initState, ES_SM_TOP_IDX, 1U, ES_SM_SIG(SIG_INIT))
+ES_SM_STATE_TABLE_END(StateTable);
+
+static esStatus_T chainState(
+    void *          sm,
+    const esEvt_T * evt,
+    uint_fast8_t    level) {
+
+    esStatus_T      status;
+
+    HandlerCalls++;
+
+    switch (evt->id) {
+        case SIG_ENTRY :
+        case SIG_EXIT :
+        case SIG_INIT : {
+            status = ES_STATE_HANDLED();
+            break;
+        }
+
+        case SIG_LEAF : {
+
+            if (DEPTH == level) {
+                status = ES_STATE_HANDLED();
+                break;
+            }
+        }
+        /* fall through */
+
+        case SIG_ROOT : {
+
+            if (1U == level) {
+                status = ES_STATE_HANDLED();
+                break;
+            }
+        }
+        /* fall through */
+
+        default : {
+
+            if (1U == level) {
+                status = ES_STATE_SUPER(sm, esSmTopState);
+            } else {
+                status = ES_STATE_SUPER(sm, NULL);
+            }
+            break;
+        }
+    }
+
+    return (status);
+}
+
+static esStatus_T initState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    if (SIG_INIT == evt->id) {
+        status = ES_STATE_TRAN(sm, chainState8);
+    } else {
+        status = ES_STATE_SUPER(sm, esSmTopState);
+    }
+
+    return (status);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const char * const signalName[SIGNAL_NUM] = {
+        "leaf",
+        "root",
+        "none"
+    };
+    static const esEvt_T initEvt = {
+        .id = (esEvtId_T)SIG_INIT
+    };
+    esSmDef_T       definition = {
+        .smWorkspaceSize  = sizeof(esSm_T),
+        .smInitState      = initState,
+        .smLevels         = DEPTH + 1U,
+        .smStateTable     = &StateTable
+    };
+    esEvt_T         evt;
+    esSm_T *        sm;
+    uint32_t        dispatchNum;
+    uint32_t        skipped;
+    uint32_t        signal;
+    uint32_t        cnt;
+    uint64_t        startTime;
+    uint64_t        time;
+
+    dispatchNum = benchCount(argc, argv, 2000000U);
+    esSmpInit();
+    sm = esSmCreate(
+        &esMemDynClass,
+        &definition);
+    (void)esSmDispatch(
+        sm,
+        &initEvt);
+
+    for (signal = 0U; signal < SIGNAL_NUM; signal++) {
+        evt.id = (esEvtId_T)(SIG_LEAF + signal);
+        HandlerCalls = 0U;
+#if (1U == OPT_SMP_STATE_MASK)
+        skipped = esSmSkippedGet(
+            sm);
+#else
+        skipped = 0U;
+#endif
+        startTime = benchTimeNs();
+
+        for (cnt = 0U; cnt < dispatchNum; cnt++) {
+            (void)esSmDispatch(
+                sm,
+                &evt);
+        }
+        time = benchTimeNs() - startTime;
+#if (1U == OPT_SMP_STATE_MASK)
+        skipped = esSmSkippedGet(
+            sm) - skipped;
+#endif
+        (void)printf("hsm_mask: mask=%s signal=%s depth=%u dispatches=%u time=%.3f ms dispatch=%.1f ns calls=%.2f skipped=%.2f\n",
+            MASK_NAME,
+            signalName[signal],
+            DEPTH,
+            dispatchNum,
+            (double)time / 1e6,
+            (double)time / (double)dispatchNum,
+            (double)HandlerCalls / (double)dispatchNum,
+            (double)skipped / (double)dispatchNum);
+    }
+    esSmDestroy(
+        sm);
+
+    return (EXIT_SUCCESS);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (OPT_SMP_SM_TYPES != ES_SMP_HSM_ONLY) || (1U != OPT_SMP_STATE_TABLE)
+# error "hsm_mask: benchmark requires HSM only state machines with the state hierarchy table."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of hsm_mask.c
+ ******************************************************************************/
@@ -0,0 +1,323 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       HSM transition cost over hierarchy depth
+ * @details     The state machine has two branches of states below the top
+ *              state, each nested DEPTH levels deep. Every event moves the
+ *              machine from the leaf of one branch to the leaf of the other, so
+ *              each transition exits and enters DEPTH states through the top
+ *              state. The first argument is the transition count, the second
+ *              one the depth, 1 to DEPTH_MAX, and the third one turns the
+ *              transition cache on (1) or off (0). The program reports the
+ *              time per transition and the hit and miss counts of the cache.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define DEPTH_MAX                       16U
+#define SIG_TOGGLE                      (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+#define BRANCH_STATE(branch, level)                                             \
+    static esStatus_T state ## branch ## _ ## level(                            \
+        void *          sm,                                                     \
+        esEvt_T *       evt) {                                                  \
+                                                                                \
+        return (branchState(sm, evt, branch, level));                           \
+    }
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T branchState(
+    void *          sm,
+    const esEvt_T * evt,
+    uint_fast8_t    branch,
+    uint_fast8_t    level);
+
+static esStatus_T initState(
+    void *          sm,
+    esEvt_T *       evt);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static uint_fast8_t Depth;
+
+ES_SM_TRAN_CACHE(TranCache, 16U, DEPTH_MAX + 2U);
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+BRANCH_STATE(0, 1)
+
+BRANCH_STATE(0, 2)
+
+BRANCH_STATE(0, 3)
+
+BRANCH_STATE(0, 4)
+
+BRANCH_STATE(0, 5)
+
+BRANCH_STATE(0, 6)
+
+BRANCH_STATE(0, 7)
+
+BRANCH_STATE(0, 8)
+
+BRANCH_STATE(0, 9)
+
+BRANCH_STATE(0, 10)
+
+BRANCH_STATE(0, 11)
+
+BRANCH_STATE(0, 12)
+
+BRANCH_STATE(0, 13)
+
+BRANCH_STATE(0, 14)
+
+BRANCH_STATE(0, 15)
+
+BRANCH_STATE(0, 16)
+
+BRANCH_STATE(1, 1)
+
+BRANCH_STATE(1, 2)
+
+BRANCH_STATE(1, 3)
+
+BRANCH_STATE(1, 4)
+
+BRANCH_STATE(1, 5)
+
+BRANCH_STATE(1, 6)
+
+BRANCH_STATE(1, 7)
+
+BRANCH_STATE(1, 8)
+
+BRANCH_STATE(1, 9)
+
+BRANCH_STATE(1, 10)
+
+BRANCH_STATE(1, 11)
+
+BRANCH_STATE(1, 12)
+
+BRANCH_STATE(1, 13)
+
+BRANCH_STATE(1, 14)
+
+BRANCH_STATE(1, 15)
+
+BRANCH_STATE(1, 16)
+
+static const esState_T Branch[2][DEPTH_MAX + 1U] = {
+    {
+        NULL,
+        state0_1,
+        state0_2,
+        state0_3,
+        state0_4,
+        state0_5,
+        state0_6,
+        state0_7,
+        state0_8,
+        state0_9,
+        state0_10,
+        state0_11,
+        state0_12,
+        state0_13,
+        state0_14,
+        state0_15,
+        state0_16
+    },
+    {
+        NULL,
+        state1_1,
+        state1_2,
+        state1_3,
+        state1_4,
+        state1_5,
+        state1_6,
+        state1_7,
+        state1_8,
+        state1_9,
+        state1_10,
+        state1_11,
+        state1_12,
+        state1_13,
+        state1_14,
+        state1_15,
+        state1_16
+    }
+};
+
+static esStatus_T branchState(
+    void *          sm,
+    const esEvt_T * evt,
+    uint_fast8_t    branch,
+    uint_fast8_t    level) {
+
+    esStatus_T      status;
+
+    switch (evt->id) {
+        case SIG_ENTRY :
+        case SIG_EXIT :
+        case SIG_INIT : {
+            status = ES_STATE_HANDLED();
+            break;
+        }
+
+        case SIG_TOGGLE : {
+
+            if (Depth == level) {
+                status = ES_STATE_TRAN(sm, Branch[1U - branch][Depth]);
+                break;
+            }
+        }
+        /* fall through */
+
+        default : {
+
+            if (1U == level) {
+                status = ES_STATE_SUPER(sm, esSmTopState);
+            } else {
+                status = ES_STATE_SUPER(sm, Branch[branch][level - 1U]);
+            }
+            break;
+        }
+    }
+
+    return (status);
+}
+
+static esStatus_T initState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    if (SIG_INIT == evt->id) {
+        status = ES_STATE_TRAN(sm, Branch[0][Depth]);
+    } else {
+        status = ES_STATE_SUPER(sm, esSmTopState);
+    }
+
+    return (status);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEvt_T initEvt = {
+        .id = (esEvtId_T)SIG_INIT
+    };
+    static const esEvt_T toggleEvt = {
+        .id = (esEvtId_T)SIG_TOGGLE
+    };
+    esSmDef_T       definition = {
+        .smWorkspaceSize  = sizeof(esSm_T),
+        .smInitState      = initState,
+        .smLevels         = DEPTH_MAX + 2U
+    };
+    esSmTranCacheStatus_T status;
+    esSm_T *        sm;
+    uint32_t        tranNum;
+    uint32_t        cnt;
+    uint64_t        startTime;
+    uint64_t        time;
+
+    tranNum = benchCount(argc, argv, 2000000U);
+    Depth = 2U;
+
+    if (2 < argc) {
+        Depth = (uint_fast8_t)strtoul(argv[2], NULL, 0);
+    }
+
+    if ((0U == Depth) || (DEPTH_MAX < Depth)) {
+        (void)printf("hsm_tran: depth must be in range 1 - %u\n",
+            DEPTH_MAX);
+
+        return (EXIT_FAILURE);
+    }
+
+    if ((3 < argc) && (0UL != strtoul(argv[3], NULL, 0))) {
+        definition.smTranCache = &TranCache;
+    }
+    esSmpInit();
+    sm = esSmCreate(
+        &esMemDynClass,
+        &definition);
+    (void)esSmDispatch(
+        sm,
+        &initEvt);
+    startTime = benchTimeNs();
+
+    for (cnt = 0U; cnt < tranNum; cnt++) {
+        (void)esSmDispatch(
+            sm,
+            &toggleEvt);
+    }
+    time = benchTimeNs() - startTime;
+    esSmTranCacheStatusGet(
+        &TranCache,
+        &status);
+    (void)printf("hsm_tran: depth=%u cache=%s transitions=%u time=%.3f ms transition=%.1f ns hit=%u miss=%u\n",
+        (unsigned)Depth,
+        (NULL != definition.smTranCache) ? "on" : "off",
+        tranNum,
+        (double)time / 1e6,
+        (double)time / (double)tranNum,
+        status.hit,
+        status.miss);
+    esSmDestroy(
+        sm);
+
+    return (EXIT_SUCCESS);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (OPT_SMP_SM_TYPES != ES_SMP_HSM_ONLY) || (1U != OPT_SMP_TRAN_CACHE)
+# error "hsm_tran: benchmark requires HSM only state machines with the transition cache."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of hsm_tran.c
+ ******************************************************************************/
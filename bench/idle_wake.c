@@ -0,0 +1,194 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       CPU usage of the idle kernel and wake-up latency
+ * @details     A host thread leaves the kernel idle for IDLE_NS, then posts an
+ *              event stamped with the current time, and waits until the EPA
+ *              object handles it. The program reports the CPU time used by the
+ *              whole process as a share of the wall time and the average and
+ *              worst time from the post to the start of the handler. It is
+ *              built with one CPU, with four CPUs and with the TEM module,
+ *              whose tick is stopped while all CPUs are idle.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define IDLE_NS                         1000000UL
+#define SIG_WAKE                        (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+
+struct wakeEvt {
+    esEvt_T         evt;
+    uint64_t        stamp;
+};
+
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T sleeperState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static void * waker(
+    void *          arg);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esEpa_T * Sleeper;
+
+static sem_t Handled;
+
+static uint64_t Latency;
+
+static uint64_t LatencyMax;
+
+static uint32_t WakeNum;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T sleeperState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_WAKE == evt->id) {
+        uint64_t    latency;
+
+        latency = benchTimeNs() - ((struct wakeEvt *)evt)->stamp;
+        Latency += latency;
+
+        if (LatencyMax < latency) {
+            LatencyMax = latency;
+        }
+        (void)sem_post(
+            &Handled);
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+static void * waker(
+    void *          arg) {
+
+    static const struct timespec idle = {
+        .tv_sec  = 0,
+        .tv_nsec = IDLE_NS
+    };
+    uint32_t        cnt;
+    uint64_t        startTime;
+    uint64_t        startCpuTime;
+    uint64_t        time;
+    uint64_t        cpuTime;
+
+    (void)arg;
+    (void)nanosleep(&idle, NULL);                                               /* Let the kernel reach the idle loop first.                */
+    startTime = benchTimeNs();
+    startCpuTime = benchCpuTimeNs();
+
+    for (cnt = 0U; cnt < WakeNum; cnt++) {
+        struct wakeEvt * evt;
+
+        (void)nanosleep(&idle, NULL);
+        evt = (struct wakeEvt *)esEvtCreate(
+            sizeof(struct wakeEvt),
+            (esEvtId_T)SIG_WAKE);
+        evt->stamp = benchTimeNs();
+        esEvtPost(
+            Sleeper,
+            &evt->evt);
+        (void)sem_wait(
+            &Handled);
+    }
+    time = benchTimeNs() - startTime;
+    cpuTime = benchCpuTimeNs() - startCpuTime;
+    (void)printf("idle_wake: cpus=%u tem=%u wakes=%u time=%.3f ms cpu=%.2f %% latency=%.1f us max=%.1f us\n",
+        (unsigned)OPT_KERNEL_CPU_NUM,
+        (unsigned)OPT_TEM_ENABLE,
+        WakeNum,
+        (double)time / 1e6,
+        100.0 * (double)cpuTime / (double)time,
+        (double)Latency / (double)WakeNum / 1e3,
+        (double)LatencyMax / 1e3);
+    exit(EXIT_SUCCESS);
+
+    return (NULL);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T definition = {
+        .epaName          = "sleeper",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 4U,
+        .smInitState      = sleeperState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    pthread_t       thread;
+
+    WakeNum = benchCount(argc, argv, 1000U);
+
+    if (0U == WakeNum) {
+
+        return (EXIT_FAILURE);
+    }
+    (void)sem_init(&Handled, 0, 0U);
+    esKernelInit();
+    Sleeper = esEpaCreate(
+        &esMemDynClass,
+        &definition);
+    (void)pthread_create(&thread, NULL, waker, NULL);
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of idle_wake.c
+ ******************************************************************************/
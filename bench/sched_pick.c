@@ -0,0 +1,150 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Cost of picking the next ready EPA object
+ * @details     One EPA object is created for each priority level and every
+ *              dispatch forwards a token to a randomly chosen EPA object, so
+ *              the ready bitmap stays sparse and random. The program is built
+ *              for 8, 64, 512 and 4096 priority levels. The work done besides
+ *              picking the next EPA object is the same in all builds, so equal
+ *              time per dispatch means constant time pick-next.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define EPA_NUM                         OPT_KERNEL_EPA_PRIO_MAX
+#define TOKEN_NUM                       8U
+#define SIG_TOKEN                       (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esEpa_T * Node[EPA_NUM];
+
+static uint32_t Seed;
+
+static uint32_t Dispatched;
+
+static uint32_t EvtNum;
+
+static uint64_t StartTime;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_TOKEN == evt->id) {
+        Seed = Seed * 1103515245U + 12345U;
+        esEvtPost(
+            Node[(Seed >> 8U) % EPA_NUM],
+            esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_TOKEN));
+        Dispatched++;
+
+        if (EvtNum == Dispatched) {
+            uint64_t time;
+
+            time = benchTimeNs() - StartTime;
+            (void)printf("sched_pick: priorities=%u events=%u time=%.3f ms dispatch=%.1f ns\n",
+                (unsigned)OPT_KERNEL_EPA_PRIO_MAX,
+                EvtNum,
+                (double)time / 1e6,
+                (double)time / (double)EvtNum);
+            exit(EXIT_SUCCESS);
+        }
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T definition = {
+        .epaName          = "node",
+        .epaPrio          = 0U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 2U * TOKEN_NUM,
+        .smInitState      = nodeState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    uint32_t        cnt;
+
+    EvtNum = benchCount(argc, argv, 2000000U);
+    esKernelInit();
+
+    for (cnt = 0U; cnt < EPA_NUM; cnt++) {
+        esEpaDef_T  def;
+
+        def = definition;
+        def.epaPrio = (uint16_t)cnt;
+        Node[cnt] = esEpaCreate(
+            &esMemDynClass,
+            &def);
+    }
+
+    for (cnt = 0U; cnt < TOKEN_NUM; cnt++) {
+        esEvtPost(
+            Node[(cnt * 997U) % EPA_NUM],
+            esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_TOKEN));
+    }
+    StartTime = benchTimeNs();
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of sched_pick.c
+ ******************************************************************************/
@@ -0,0 +1,167 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Throughput of the SMP dispatcher
+ * @details     EPA objects pass tokens to each other, every token is a new
+ *              event and every dispatch does a fixed amount of work. The
+ *              program is built once for each value of OPT_KERNEL_CPU_NUM and
+ *              reports dispatched events per second, so the outputs of all
+ *              builds give the scaling over 1..N cores.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define EPA_NUM                         64U
+#define TOKEN_NUM                       4U
+#define WORK_LOOPS                      500U
+#define SIG_TOKEN                       (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+
+struct node {
+    esEpa_T         epa;
+    uint32_t        next;
+    uint32_t        seed;
+};
+
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static struct node * Node[EPA_NUM];
+
+static atomic_uint_fast32_t Dispatched;
+
+static uint32_t EvtNum;
+
+static uint64_t StartTime;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T nodeState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    struct node *   node;
+    esStatus_T      status;
+
+    node = (struct node *)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_TOKEN == evt->id) {
+        uint32_t    cnt;
+        uint_fast32_t done;
+
+        for (cnt = 0U; cnt < WORK_LOOPS; cnt++) {                               /* Simulate processing of the event.                        */
+            node->seed = node->seed * 1103515245U + 12345U;
+        }
+        benchKeep(node->seed);
+        node->next = (node->next + 7U) % EPA_NUM;
+        esEvtPost(
+            &Node[node->next]->epa,
+            esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_TOKEN));
+        done = atomic_fetch_add(&Dispatched, 1U) + 1U;
+
+        if (EvtNum == done) {
+            uint64_t time;
+
+            time = benchTimeNs() - StartTime;
+            (void)printf("smp_scaling: cpus=%u events=%u time=%.3f ms throughput=%.0f events/s\n",
+                (unsigned)OPT_KERNEL_CPU_NUM,
+                EvtNum,
+                (double)time / 1e6,
+                (double)EvtNum * 1e9 / (double)time);
+            exit(EXIT_SUCCESS);
+        }
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T definition = {
+        .epaName          = "node",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(struct node),
+        .evtQueueLevels   = 2U * TOKEN_NUM * EPA_NUM,
+        .smInitState      = nodeState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    uint32_t        cnt;
+
+    EvtNum = benchCount(argc, argv, 1000000U);
+    esKernelInit();
+
+    for (cnt = 0U; cnt < EPA_NUM; cnt++) {
+        esEpaDef_T  def;
+
+        def = definition;
+        def.epaPrio = (uint16_t)(1U + (cnt % 8U));
+        def.epaCpu = (uint8_t)(cnt % OPT_KERNEL_CPU_NUM);
+        Node[cnt] = (struct node *)esEpaCreate(
+            &esMemDynClass,
+            &def);
+        Node[cnt]->next = cnt;
+        Node[cnt]->seed = cnt;
+    }
+
+    for (cnt = 0U; cnt < (TOKEN_NUM * EPA_NUM); cnt++) {
+        esEvtPost(
+            &Node[cnt % EPA_NUM]->epa,
+            esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_TOKEN));
+    }
+    StartTime = benchTimeNs();
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of smp_scaling.c
+ ******************************************************************************/
@@ -0,0 +1,250 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Cost of one system tick against the number of time events
+ * @details     A driver EPA object calls esTemTickI() in chunks of ticks and
+ *              measures only those calls. The system timer of the port is
+ *              disabled, so no other tick moves the wheel. A fixed set of
+ *              ACTIVE_NUM periodic time events with short periods expires all
+ *              the time. All other time events have long periods, like
+ *              timeouts which are armed but rarely expire, and only move
+ *              between the levels of the wheel. With a constant expiry rate the
+ *              time per tick should not grow with the time event count.
+ *              Expired events go to a sink EPA object of higher priority which
+ *              empties its queue between the chunks. The first argument is the
+ *              tick count and the second one is the time event count.
+ * @addtogroup  bench
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+
+#include "eds/kernel.h"
+#include "bench.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define TICK_CHUNK                      64U
+#define PERIOD_MIN                      TICK_CHUNK                              /* Period of a time event is at least one chunk, so it     */
+                                                                                /* expires at most once per chunk and the sink queue of    */
+                                                                                /* TimerNum events never overflows.                        */
+#define ACTIVE_NUM                      1024U
+#define ACTIVE_PERIOD_PWR               12U
+#define IDLE_PERIOD_PWR                 20U
+#define SIG_TICKS                       (SIG_ID_USR + 1U)
+#define SIG_EXPIRED                     (SIG_ID_USR + 2U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T driverState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static esStatus_T sinkState(
+    void *          sm,
+    esEvt_T *       evt);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static esEpa_T * Driver;
+
+static esEpa_T * Sink;
+
+static esTimeEvt_T * TimeEvt;
+
+static uint32_t TickNum;
+
+static uint32_t TimerNum;
+
+static uint32_t Ticked;
+
+static uint32_t Expired;
+
+static uint64_t TickTime;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T driverState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    switch (evt->id) {
+        case SIG_INIT : {
+            PORT_SYSTMR_ISR_DISABLE();
+            esEvtPost(
+                Driver,
+                esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_TICKS));
+            status = ES_STATE_HANDLED();
+            break;
+        }
+
+        case SIG_TICKS : {
+            uint32_t    cnt;
+            uint64_t    startTime;
+            PORT_CRITICAL_DECL;
+
+            PORT_CRITICAL_ENTER();
+            startTime = benchTimeNs();
+
+            for (cnt = 0U; cnt < TICK_CHUNK; cnt++) {
+                esTemTickI();
+            }
+            TickTime += benchTimeNs() - startTime;
+            PORT_CRITICAL_EXIT();
+            Ticked += TICK_CHUNK;
+
+            if (TickNum <= Ticked) {
+                (void)printf("tem_tick: timers=%u ticks=%u expired=%u time=%.3f ms tick=%.1f ns\n",
+                    TimerNum,
+                    Ticked,
+                    Expired,
+                    (double)TickTime / 1e6,
+                    (double)TickTime / (double)Ticked);
+                exit(EXIT_SUCCESS);
+            }
+            esEvtPost(
+                Driver,
+                esEvtCreate(sizeof(esEvt_T), (esEvtId_T)SIG_TICKS));
+            status = ES_STATE_HANDLED();
+            break;
+        }
+
+        default : {
+            break;
+        }
+    }
+
+    return (status);
+}
+
+static esStatus_T sinkState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    esStatus_T      status;
+
+    (void)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_EXPIRED == evt->id) {
+        Expired++;
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    int             argc,
+    char **         argv) {
+
+    static const esEpaDef_T driverDef = {
+        .epaName          = "driver",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .evtQueueLevels   = 4U,
+        .smInitState      = driverState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    esEpaDef_T      sinkDef = {
+        .epaName          = "sink",
+        .epaPrio          = 2U,
+        .epaWorkspaceSize = sizeof(esEpa_T),
+        .smInitState      = sinkState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    uint32_t        seed;
+    uint32_t        cnt;
+
+    TickNum = benchCount(argc, argv, 1000000U);
+    TimerNum = 100000U;
+
+    if (2 < argc) {
+        TimerNum = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    TimeEvt = calloc(TimerNum, sizeof(esTimeEvt_T));
+
+    if ((NULL == TimeEvt) && (0U != TimerNum)) {
+
+        return (EXIT_FAILURE);
+    }
+    sinkDef.evtQueueLevels = TimerNum + 1U;
+    esKernelInit();
+    Driver = esEpaCreate(
+        &esMemDynClass,
+        &driverDef);
+    Sink = esEpaCreate(
+        &esMemDynClass,
+        &sinkDef);
+    seed = 1U;
+
+    for (cnt = 0U; cnt < TimerNum; cnt++) {
+        esEvt_T *   evt;
+        esTick_T    period;
+
+        evt = esEvtCreate(
+            sizeof(esEvt_T),
+            (esEvtId_T)SIG_EXPIRED);
+        esEvtReserve(
+            evt);
+        esTimeEvtInit(
+            &TimeEvt[cnt],
+            Sink,
+            evt);
+        seed = seed * 1103515245U + 12345U;
+
+        if (ACTIVE_NUM > cnt) {
+            period = PERIOD_MIN + ((seed >> 8U) & ((1U << ((seed >> 4U) % ACTIVE_PERIOD_PWR)) - 1U));
+        } else {
+            period = (1U << IDLE_PERIOD_PWR) + ((seed >> 8U) & ((1U << IDLE_PERIOD_PWR) - 1U));
+        }
+        esTimeEvtArm(
+            &TimeEvt[cnt],
+            period,
+            period);
+    }
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of tem_tick.c
+ ******************************************************************************/
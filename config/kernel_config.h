@@ -35,17 +35,18 @@
 
 #define ES_MM_DYNAMIC_ONLY              0
 #define ES_MM_STATIC_ONLY               -1
-#define ES_SMP_FSM_ONLY                 1
-#define ES_SMP_HSM_ONLY                 2
-#define ES_SMP_FSM_AND_HSM              3
 #define ES_KERNEL_API_MM                0
 #define ES_KERNEL_API_SM                1
 #define ES_KERNEL_API_FULL              2
 
 /* Ovde se pisu podesavanja projekta -----------------------------------------*/
 
-# define OPT_EVT_USE_GENERATOR
+#if !defined(CFG_EVT_USE_GENERATOR)
+# define CFG_EVT_USE_GENERATOR          1
+#endif
+#if !defined(OPT_KERNEL_EPA_PRIO_MAX)
 # define OPT_KERNEL_EPA_PRIO_MAX        9U
+#endif
 
 /*==============================================================  SETTINGS  ==*/
 
@@ -89,6 +90,12 @@
  */
 #define ES_SMP_FSM_AND_HSM              3U
 
+/**
+ * @brief       Koristi se za opciju @ref OPT_SMP_SM_TYPES : Omoguceni su samo
+ *              FSM automati zadati tabelom prelaza
+ */
+#define ES_SMP_FSM_TABLE                4U
+
 /**@} *//*----------------------------------------------------------------*//**
  * @name        Podesavanje Kernel-a
  * @{ *//*--------------------------------------------------------------------*/
@@ -118,16 +125,162 @@
 
 /**
  * @brief       Maksimalan prioritet EPA objekata u sistemu
- * @details     Ova opcija omogucava da se ujedno definise maksimalan broj EPA
- *              objekata u sistemu. Podrazumevano podesavanje je 64 sto je i
- *              maksimalan broj prioriteta na 8-bitnoj arhitekturi. 16-bitne i
- *              32-bitne arhitekture podrazavaju vide od 64 EPA objekata.
+ * @details     Ova opcija definise broj nivoa prioriteta. Vise EPA objekata
+ *              moze deliti isti prioritet i tada se izvrsavaju po round-robin
+ *              principu, tako da broj EPA objekata u sistemu nije ogranicen
+ *              ovom opcijom. Bitmapa spremnih EPA objekata ima onoliko nivoa
+ *              koliko je potrebno da se pokrije zadati broj prioriteta, a
+ *              najveca podrzana vrednost je 4096.
  * @note        Podrazumevano podesavanje: 8 nivoa
  */
 #if !defined(OPT_KERNEL_EPA_PRIO_MAX) || defined(__DOXYGEN__)
 # define OPT_KERNEL_EPA_PRIO_MAX        8U
 #endif
 
+/**
+ * @brief       Broj procesorskih jezgara koje koristi kernel
+ * @details     Kada je vrednost veca od 1 kernel radi u SMP rezimu: svako
+ *              jezgro izvrsava svoj dispecer i ima svoju bitmapu spremnih EPA
+ *              objekata. EPA objekat se dodeljuje jezgru preko clana
+ *              esEpaDef_T::epaCpu. Jezgro koje nema spremnih EPA objekata
+ *              preuzima (work stealing) spreman EPA objekat sa drugog jezgra.
+ *              Jedan EPA objekat se nikada ne izvrsava na dva jezgra
+ *              istovremeno, tako da se redosled obrade dogadjaja zadrzava.
+ *
+ *              Port mora da obezbedi makroe @c PORT_CPU_ID i
+ *              @c PORT_CPU_START.
+ * @note        Podrazumevano podesavanje: 1 (jedno jezgro)
+ */
+#if !defined(OPT_KERNEL_CPU_NUM) || defined(__DOXYGEN__)
+# define OPT_KERNEL_CPU_NUM             1U
+#endif
+
+/**
+ * @brief       Maksimalan broj dogadjaja koji se obradjuju u jednoj grupi
+ * @details     Dispecer uzima do ovoliko dogadjaja iz reda izabranog EPA
+ *              objekta u jednoj kriticnoj sekciji, obradjuje ih jedan za
+ *              drugim i zatim ih unistava u jednoj kriticnoj sekciji. Vece
+ *              vrednosti smanjuju broj ulazaka u kriticnu sekciju po dogadjaju,
+ *              ali EPA objekat viseg prioriteta moze da ceka da se obradi cela
+ *              grupa. Vrednost 1 daje obradu dogadjaj po dogadjaj.
+ * @note        Podrazumevano podesavanje: 1 (bez grupisanja)
+ */
+#if !defined(OPT_KERNEL_DISPATCH_BATCH) || defined(__DOXYGEN__)
+# define OPT_KERNEL_DISPATCH_BATCH      1U
+#endif
+
+/**
+ * @brief       Lock-free red cekanja za dogadjaje
+ * @details     Kada je opcija ukljucena redovi cekanja EPA objekata su
+ *              ograniceni lock-free MPSC redovi bazirani na C11 atomskim
+ *              operacijama. esEvtPost() tada ne koristi kriticnu sekciju za
+ *              upis dogadjaja, vec samo kada red cekanja postane neprazan i EPA
+ *              objekat treba ubaciti u red spremnih EPA objekata. Dogadjaji se
+ *              mogu slati sa drugih jezgara i iz obradjivaca signala bez
+ *              globalnog zakljucavanja.
+ *
+ *              Kapacitet reda se zaokruzuje na prvi veci stepen dvojke, a
+ *              esEvtPostAhead() upisuje dogadjaj na kraj reda.
+ *              - 0 - red cekanja koristi esQp_T i kriticnu sekciju
+ *              - 1 - lock-free red cekanja, zahteva C11 kompajler
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_KERNEL_EVTQ_LOCKFREE) || defined(__DOXYGEN__)
+# define OPT_KERNEL_EVTQ_LOCKFREE       0U
+#endif
+
+/**
+ * @brief       Redovi cekanja za dogadjaje velicine stepena dvojke
+ * @details     Kada je opcija ukljucena redovi cekanja EPA objekata koriste
+ *              esQpPow2_T umesto esQp_T. Indeksi se samo povecavaju, a pozicija
+ *              u baferu se dobija maskiranjem, tako da upis i citanje nemaju
+ *              grananja, a provera da li je red pun ili prazan je jedno
+ *              oduzimanje. esEpaCreate() zaokruzuje esEpaDef_T::evtQueueLevels
+ *              na prvi veci stepen dvojke.
+ *              - 0 - koristi se esQp_T
+ *              - 1 - koristi se esQpPow2_T
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_KERNEL_EVTQ_POW2) || defined(__DOXYGEN__)
+# define OPT_KERNEL_EVTQ_POW2           0U
+#endif
+
+/**
+ * @brief       Dogadjaji po vrednosti
+ * @details     Kada je opcija ukljucena mali dogadjaji koji nose samo
+ *              identifikator i jednu masinsku rec salju se funkcijom
+ *              esEvtPostValue(). Takav dogadjaj se ne kreira: identifikator i
+ *              vrednost se upisuju direktno u red cekanja, a dispecer ih pre
+ *              obrade smesta u esEvtValue_T strukturu na svom steku, tako da
+ *              funkcija stanja i dalje dobija pokazivac na esEvt_T.
+ *
+ *              U redovima esQp_T i esQpPow2_T dogadjaj po vrednosti zauzima
+ *              dve lokacije, a lokacije lock-free reda se prosiruju za jednu
+ *              masinsku rec.
+ *              - 0 - iskljuceno
+ *              - 1 - ukljuceno
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_KERNEL_EVT_VALUE) || defined(__DOXYGEN__)
+# define OPT_KERNEL_EVT_VALUE           0U
+#endif
+
+/**
+ * @brief       Hitan red cekanja
+ * @details     Kada je opcija ukljucena svaki EPA objekat ima i drugi, hitan
+ *              red cekanja velicine esEpaDef_T::evtUrgentLevels. Funkcija
+ *              esEvtPostAhead() tada upisuje dogadjaj na kraj hitnog reda, a
+ *              dispecer prazni hitan red pre obicnog. Redosled dogadjaja je
+ *              ocuvan unutar svakog reda i hitni dogadjaji ne zauzimaju mesto
+ *              u obicnom redu.
+ *
+ *              Kada je opcija iskljucena esEvtPostAhead() upisuje dogadjaj na
+ *              pocetak obicnog reda, pa se vise hitnih dogadjaja obradjuje
+ *              obrnutim redosledom.
+ *              - 0 - iskljuceno
+ *              - 1 - ukljuceno
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_KERNEL_EVTQ_URGENT) || defined(__DOXYGEN__)
+# define OPT_KERNEL_EVTQ_URGENT         0U
+#endif
+
+/**
+ * @brief       Broj lokacija zajednickog prostora za prelivanje dogadjaja
+ * @details     Kada je vrednost veca od nule, dogadjaj koji se salje EPA
+ *              objektu ciji je red cekanja pun se ne unistava vec se smesta u
+ *              zajednicku listu prelivenih dogadjaja kernela. Dispecer vraca
+ *              prelivene dogadjaje u red cekanja cim se u njemu oslobodi
+ *              mesto, pri cemu se redosled dogadjaja ne menja. Tako se redovi
+ *              cekanja mogu dimenzionisati za uobicajeno opterecenje, a
+ *              kratkotrajni naleti se prihvataju iz zajednickog prostora.
+ *
+ *              Opcija nije podrzana uz @ref OPT_KERNEL_EVTQ_LOCKFREE.
+ *              - 0 - iskljuceno
+ *              - N - broj dogadjaja koji mogu istovremeno biti preliveni
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_KERNEL_EVT_SPILL) || defined(__DOXYGEN__)
+# define OPT_KERNEL_EVT_SPILL           0U
+#endif
+
+/**
+ * @brief       Broj signala koji se mogu objavljivati preko EPN mreze
+ * @details     Kada je vrednost veca od nule ukljucuje se Event Processing
+ *              Network (EPN): EPA objekti se pretplacuju na signale pozivom
+ *              esEpnSubscribe(), a esEvtPublish() jedan dogadjaj salje svim
+ *              pretplatnicima. Za svaki signal cuva se bitmapa prioriteta
+ *              pretplatnika, a EPA objekti istog prioriteta se obilaze preko
+ *              liste. Identifikatori dogadjaja koji se objavljuju moraju biti
+ *              manji od ove vrednosti.
+ *              - 0 - EPN je iskljucen
+ *              - N - omoguceno objavljivanje signala 0 do N - 1
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_KERNEL_EPN_SIGNAL_MAX) || defined(__DOXYGEN__)
+# define OPT_KERNEL_EPN_SIGNAL_MAX      0U
+#endif
+
 /**
  * @brief       Maksimalan prioritet prekidnih rutina kernela
  * @details     Ovim se ogranicava prioritet prekidnih rutina koje jezgro
@@ -196,6 +349,10 @@
  *              - @ref ES_SMP_HSM_ONLY - omoguceni su samo HSM automati
  *              - @ref ES_SMP_FSM_AND_HSM - omogucena su oba tipa automata,
  *              selekcija dispecera se vrsi dinamicki.
+ *              - @ref ES_SMP_FSM_TABLE - omoguceni su samo FSM automati zadati
+ *              tabelom prelaza (esSmTable_T). Stanja i signali su mali celi
+ *              brojevi, a obrada dogadjaja je jedno citanje tabele i opciono
+ *              pozivanje akcije.
  *
  * @note        Podrazumevano podesavanje: @ref ES_SMP_FSM_AND_HSM
  */
@@ -203,6 +360,97 @@
 # define OPT_SMP_SM_TYPES               ES_SMP_FSM_ONLY
 #endif
 
+/**
+ * @brief       Kes putanja tranzicija HSM automata
+ * @details     Kada je opcija ukljucena HSM dispecer pamti, za svaki par
+ *              (izvoriste, odrediste), listu stanja za izlaz i listu stanja za
+ *              ulaz koje je pronasao hsmTranFindPath(). Ponovljena tranzicija
+ *              se izvrsava bez slanja SIG_SUPER signala funkcijama stanja. Kes
+ *              se deklarise makroom ES_SM_TRAN_CACHE() i dodeljuje definicionoj
+ *              strukturi automata, pa ga dele svi automati iste definicije.
+ *              - 0 - iskljuceno
+ *              - 1 - ukljuceno
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_SMP_TRAN_CACHE) || defined(__DOXYGEN__)
+# define OPT_SMP_TRAN_CACHE             0U
+#endif
+
+/**
+ * @brief       Staticke tabele hijerarhije stanja HSM automata
+ * @details     Kada je opcija ukljucena definiciona struktura automata moze da
+ *              sadrzi tabelu hijerarhije (roditelj, dubina, funkcija stanja)
+ *              deklarisanu makroima ES_SM_STATE_TABLE_BEGIN(), ES_SM_STATE() i
+ *              ES_SM_STATE_TABLE_END(). HSM dispecer tada racuna putanje
+ *              tranzicija prolaskom kroz tabelu, bez slanja SIG_SUPER signala,
+ *              a automat ne zauzima memoriju za red stanja.
+ *              - 0 - iskljuceno
+ *              - 1 - ukljuceno
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_SMP_STATE_TABLE) || defined(__DOXYGEN__)
+# define OPT_SMP_STATE_TABLE            0U
+#endif
+
+/**
+ * @brief       Maske obradjenih signala u tabelama hijerarhije stanja
+ * @details     Kada je opcija ukljucena svako stanje u tabeli hijerarhije moze
+ *              da navede masku identifikatora dogadjaja koje obradjuje
+ *              (ES_SM_STATE_MASK()). HSM dispecer preskace stanja koja ne
+ *              obradjuju dogadjaj, a dogadjaj koji ne obradjuje ni jedno stanje
+ *              odmah ignorise. Broj preskocenih poziva funkcija stanja se
+ *              dobija funkcijom esSmSkippedGet().
+ *              - 0 - iskljuceno
+ *              - 1 - ukljuceno
+ * @pre         Opcija @ref OPT_SMP_STATE_TABLE mora biti ukljucena.
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_SMP_STATE_MASK) || defined(__DOXYGEN__)
+# define OPT_SMP_STATE_MASK             0U
+#endif
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Podesavanje Time Event Management (TEM) modula
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Omogucavanje vremenskih dogadjaja
+ * @details     Kada je opcija ukljucena kernel pri pokretanju inicijalizuje
+ *              sistemski tajmer porta (PORT_SYSTMR_INIT()) i svaki sistemski
+ *              tik obradjuje funkcijom esTemTickI().
+ *              - 0 - TEM je iskljucen
+ *              - 1 - TEM je ukljucen
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_TEM_ENABLE) || defined(__DOXYGEN__)
+# define OPT_TEM_ENABLE                 0U
+#endif
+
+/**
+ * @brief       Broj nivoa hijerarhijskog tocka
+ * @details     Zajedno sa @ref OPT_TEM_WHEEL_SLOTS_PWR odredjuje opseg tocka:
+ *              vremenski dogadjaji cije je kasnjenje manje od
+ *              <code>2 ^ (OPT_TEM_WHEEL_LEVELS * OPT_TEM_WHEEL_SLOTS_PWR)</code>
+ *              tikova se razvrstavaju najvise @c OPT_TEM_WHEEL_LEVELS - 1 puta.
+ *              Duza kasnjenja su dozvoljena, ali se razvrstavaju jos jednom za
+ *              svaki opseg tocka.
+ * @note        Podrazumevano podesavanje: 4
+ */
+#if !defined(OPT_TEM_WHEEL_LEVELS) || defined(__DOXYGEN__)
+# define OPT_TEM_WHEEL_LEVELS           4U
+#endif
+
+/**
+ * @brief       Broj lokacija jednog nivoa tocka, izrazen kao stepen dvojke
+ * @details     Svaka lokacija je jedna DLS lista, tako da tocak zauzima
+ *              <code>OPT_TEM_WHEEL_LEVELS * 2 ^ OPT_TEM_WHEEL_SLOTS_PWR</code>
+ *              cuvara liste.
+ * @note        Podrazumevano podesavanje: 6 (64 lokacije)
+ */
+#if !defined(OPT_TEM_WHEEL_SLOTS_PWR) || defined(__DOXYGEN__)
+# define OPT_TEM_WHEEL_SLOTS_PWR        6U
+#endif
+
 /** @} *//*-------------------------------------------------------------------*/
 
 /*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
@@ -211,6 +459,18 @@
 # error "Kernel precondition is not satisfied: enable Interrupt module with option: OPT_HAL_INTERRUPT"
 #endif
 
+#if (0U != OPT_KERNEL_EVT_SPILL) && (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+# error "Kernel: Option OPT_KERNEL_EVT_SPILL can not be used with OPT_KERNEL_EVTQ_LOCKFREE"
+#endif
+
+#if (1U == OPT_SMP_STATE_TABLE) && (OPT_SMP_SM_TYPES != ES_SMP_HSM_ONLY) && (OPT_SMP_SM_TYPES != ES_SMP_FSM_AND_HSM)
+# error "Kernel: Option OPT_SMP_STATE_TABLE requires HSM support in OPT_SMP_SM_TYPES"
+#endif
+
+#if (1U == OPT_SMP_STATE_MASK) && (1U != OPT_SMP_STATE_TABLE)
+# error "Kernel: Option OPT_SMP_STATE_MASK requires OPT_SMP_STATE_TABLE"
+#endif
+
 /** @endcond *//** @} *//******************************************************
  * END of kernel_cfg.h
  ******************************************************************************/
@@ -192,7 +192,44 @@
 # define OPT_MEM_POOL_EXTERN            0U
 #endif
 
-#if (0U == OPT_MEM_POOL_EXTERN)  || defined(__DOXYGEN__)
+/**
+ * @brief       Pool alokator bez kriticne sekcije
+ * @details     Kada je opcija ukljucena makroi OPT_MEM_POOL_... se mogu pozvati
+ *              iz bilo kog konteksta i sa bilo kog jezgra bez kriticne
+ *              sekcije. EVT tada zauzima i oslobadja dogadjaje iz registrovanih
+ *              pool-ova bez globalnog zakljucavanja, pa se pool-ovi moraju
+ *              registrovati pre nego sto se kreira prvi dogadjaj. Ukoliko se
+ *              koristi eSolid alokator, koristi se esLfPool_T, Treiber stek sa
+ *              zastitom od ABA problema.
+ *
+ *              Moguce vrednosti:
+ *              - 0 - pool alokator se poziva unutar kriticne sekcije
+ *              - 1 - pool alokator je lock-free, zahteva C11 kompajler
+ *
+ * @note        Podrazumevano podesavanje: 0 (iskljuceno)
+ */
+#if !defined(OPT_MEM_POOL_LOCKFREE) || defined(__DOXYGEN__)
+# define OPT_MEM_POOL_LOCKFREE          0U
+#endif
+
+#if (0U == OPT_MEM_POOL_EXTERN) && (1U == OPT_MEM_POOL_LOCKFREE) && !defined(__DOXYGEN__)
+# define OPT_MEM_POOL_T                 esLfPool_T
+
+# define OPT_MEM_POOL_ALLOC(pool)                                               \
+    esLfPoolAlloc_(pool)
+
+# define OPT_MEM_POOL_ALLOCI(pool)                                              \
+    esLfPoolAlloc_(pool)
+
+# define OPT_MEM_POOL_DEALLOC(pool, mem)                                        \
+    esLfPoolDeAlloc_(pool, mem)
+
+# define OPT_MEM_POOL_DEALLOCI(pool, mem)                                       \
+    esLfPoolDeAlloc_(pool, mem)
+
+# define OPT_MEM_POOL_BLOCK_SIZE(pool)                                          \
+    esLfPoolBlockSize_(pool)
+#elif (0U == OPT_MEM_POOL_EXTERN) || defined(__DOXYGEN__)
 
 /**
  * @brief       Deskriptor Pool alokatora
@@ -222,6 +259,12 @@
  */
 # define OPT_MEM_POOL_DEALLOCI(pool, mem)                                       \
     esPMemDeAllocI(pool, mem)
+
+/**
+ * @brief       Vraca velicinu bloka pool-a
+ */
+# define OPT_MEM_POOL_BLOCK_SIZE(pool)                                          \
+    ES_PMEM_ATTR_BLOCK_SIZE_GET(pool)
 #endif
 
 /** @} *//*-------------------------------------------------------------------*/
@@ -258,7 +301,55 @@
 # define OPT_MEM_DYN_EXTERN             0U
 #endif
 
-#if (0U == OPT_MEM_DYN_EXTERN) || defined(__DOXYGEN__)
+/**
+ * @brief       Ukljucivanje TLSF dinamickog alokatora
+ * @details     Kada se koristi eSolid alokator, umesto DMem alokatora se moze
+ *              koristiti TLSF alokator (esTlsf_T) koji zauzima i oslobadja
+ *              memoriju u konstantnom vremenu. Aplikacija mora inicijalizovati
+ *              @c DefTlsfHandle funkcijom esTlsfInit() pre inicijalizacije
+ *              kernela.
+ *
+ *              Moguce vrednosti:
+ *              - 0 - koristi se DMem alokator
+ *              - 1 - koristi se TLSF alokator
+ *
+ * @note        Podrazumevano podesavanje: 0 (koristi se DMem alokator)
+ */
+#if !defined(OPT_MEM_DYN_TLSF) || defined(__DOXYGEN__)
+# define OPT_MEM_DYN_TLSF               0U
+#endif
+
+/**
+ * @brief       Logaritam gornje granice velicine bloka TLSF alokatora
+ * @details     TLSF alokator upravlja sa najvise
+ *              <code>2^OPT_MEM_TLSF_FL_MAX</code> bajtova. Svaki stepen dvojke
+ *              zauzima jedan red tabele lista u deskriptoru alokatora.
+ *
+ *              Moguce vrednosti: od 12 do 31.
+ *
+ * @note        Podrazumevano podesavanje: 20 (1MB)
+ */
+#if !defined(OPT_MEM_TLSF_FL_MAX) || defined(__DOXYGEN__)
+# define OPT_MEM_TLSF_FL_MAX            20U
+#endif
+
+#if (0U == OPT_MEM_DYN_EXTERN) && (1U == OPT_MEM_DYN_TLSF) && !defined(__DOXYGEN__)
+# define OPT_MEM_DYN_T                  esTlsf_T
+
+# define OPT_MEM_DYN_HANDLE             &DefTlsfHandle
+
+# define OPT_MEM_DYN_ALLOC(handle, size)                                        \
+    esTlsfAlloc(handle, size)
+
+# define OPT_MEM_DYN_ALLOCI(handle, size)                                       \
+    esTlsfAllocI(handle, size)
+
+# define OPT_MEM_DYN_DEALLOC(handle, mem)                                       \
+    esTlsfDeAlloc(handle, mem)
+
+# define OPT_MEM_DYN_DEALLOCI(handle, mem)                                      \
+    esTlsfDeAllocI(handle, mem)
+#elif (0U == OPT_MEM_DYN_EXTERN) || defined(__DOXYGEN__)
 
 /**
  * @brief       Deskriptor dinamickog alokatora
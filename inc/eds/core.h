@@ -36,9 +36,41 @@
 
 #include "eds/smp.h"
 #include "primitive/queue.h"
+#include "primitive/list.h"
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+# include <stdatomic.h>
+#endif
 
 /*===============================================================  DEFINES  ==*/
+
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX) || defined(__DOXYGEN__)
+/**@brief       Broj reci bitmape signala na koje je EPA objekat pretplacen
+ */
+#define ES_EPN_SIGNAL_WORDS                                                     \
+    ((OPT_KERNEL_EPN_SIGNAL_MAX + PORT_DATA_WIDTH - 1U) / PORT_DATA_WIDTH)
+#endif
+
 /*===============================================================  MACRO's  ==*/
+
+#if (1U == OPT_KERNEL_EVT_VALUE) || defined(__DOXYGEN__)
+/**@brief       Dobavlja vrednost dogadjaja po vrednosti
+ * @param       evt
+ *              Pokazivac na dogadjaj koji je poslat funkcijom
+ *              esEvtPostValue().
+ * @api
+ */
+#define ES_EVT_VALUE_GET(evt)                                                   \
+    (((const esEvtValue_T *)(evt))->value)
+
+/**@brief       Da li je dogadjaj poslat po vrednosti
+ * @api
+ */
+#define ES_EVT_IS_VALUE(evt)                                                    \
+    ((EVT_CONST_Msk | EVT_VALUE_Msk) ==                                         \
+        ((evt)->attrib & (EVT_CONST_Msk | EVT_VALUE_Msk)))
+#endif
+
 /*------------------------------------------------------  C++ extern begin  --*/
 #ifdef __cplusplus
 extern "C" {
@@ -61,13 +93,16 @@ typedef struct esEpaDef {
 
 /**@brief       Prioritet EPA objekta
  */
-    uint8_t         epaPrio;
+    uint16_t        epaPrio;
 
 /**@brief       Potrebna memorija radnog okruzenja za EPA objekat
  */
     size_t          epaWorkspaceSize;
 
 /**@brief       Velicina reda za cekanje za dogadjaje
+ * @details     Kada su ukljuceni redovi velicine stepena dvojke
+ *              (@ref OPT_KERNEL_EVTQ_POW2 ili @ref OPT_KERNEL_EVTQ_LOCKFREE)
+ *              velicina se zaokruzuje na prvi veci stepen dvojke.
  */
     size_t          evtQueueLevels;
 
@@ -78,8 +113,111 @@ typedef struct esEpaDef {
 /**@brief       Maksimalna dubina hijerarhije stanja automata.
  */
     uint8_t         smLevels;
+
+/**@brief       Kes putanja tranzicija
+ * @details     Koristi se samo kada je opcija @ref OPT_SMP_TRAN_CACHE
+ *              ukljucena. Vrednost NULL iskljucuje kes za ovu definiciju.
+ */
+    esSmTranCache_T * smTranCache;
+
+/**@brief       Tabela hijerarhije stanja
+ * @details     Koristi se samo kada je opcija @ref OPT_SMP_STATE_TABLE
+ *              ukljucena. Kada tabela postoji automat ne zauzima memoriju za
+ *              red stanja. Vrednost NULL iskljucuje tabelu.
+ */
+    const PORT_C_ROM esSmStateTable_T * smStateTable;
+
+/**@brief       Tabela prelaza
+ * @details     Koristi se samo kada je @ref OPT_SMP_SM_TYPES jednako
+ *              @ref ES_SMP_FSM_TABLE i tada zamenjuje clanove @c smInitState i
+ *              @c smLevels.
+ */
+    const PORT_C_ROM esSmTable_T * smTable;
+
+/**@brief       Jezgro kome se EPA objekat dodeljuje
+ * @details     Koristi se samo kada je @ref OPT_KERNEL_CPU_NUM vece od 1,
+ *              inace se ignorise.
+ */
+    uint8_t         epaCpu;
+
+/**@brief       Velicina reda odlozenih dogadjaja
+ * @details     Dogadjaji za koje funkcija stanja vrati RETN_DEFERRED cuvaju
+ *              se u ovom redu dok ih esEvtRecall() ne vrati u red cekanja.
+ *              Kada je vrednost 0, ili kada je red odlozenih dogadjaja pun,
+ *              odlozen dogadjaj se odmah ponovo salje na kraj reda cekanja.
+ */
+    size_t          evtDeferLevels;
+
+/**@brief       Velicina hitnog reda cekanja
+ * @details     Koristi se samo kada je opcija @ref OPT_KERNEL_EVTQ_URGENT
+ *              ukljucena i tada mora biti veca od 0, inace se ignorise.
+ */
+    size_t          evtUrgentLevels;
 } esEpaDef_T;
 
+/**@brief       Rezultat slanja dogadjaja sa povratnom informacijom
+ * @api
+ */
+typedef enum esEvtPostStatus {
+/**@brief       Dogadjaj je postavljen u red cekanja
+ */
+    EVT_POST_OK,
+
+/**@brief       Red cekanja je pun, dogadjaj nije postavljen
+ */
+    EVT_POST_FULL,
+
+/**@brief       Isteklo je vreme cekanja, dogadjaj nije postavljen
+ */
+    EVT_POST_TIMEOUT
+} esEvtPostStatus_T;
+
+/**@brief       Statistika reda odlozenih dogadjaja
+ * @api
+ */
+typedef struct esEpaDeferStatus {
+    uint32_t        deferred;                                                   /**<@brief Broj odlozenih dogadjaja                         */
+    uint32_t        recalled;                                                   /**<@brief Broj dogadjaja vracenih u red cekanja            */
+    uint32_t        overflow;                                                   /**<@brief Broj dogadjaja ponovo poslatih jer je red pun    */
+    uint32_t        saved;                                                      /**<@brief Procena broja ustedjenih obrada dogadjaja        */
+} esEpaDeferStatus_T;
+
+struct evtDeferSlot;
+
+/**@brief       Statistika prelivanja dogadjaja EPA objekta
+ * @details     Postoji samo kada je @ref OPT_KERNEL_EVT_SPILL vece od 0.
+ * @api
+ */
+typedef struct esEpaSpillStatus {
+    uint32_t        spilled;                                                    /**<@brief Broj prelivenih dogadjaja                        */
+    uint32_t        refilled;                                                   /**<@brief Broj dogadjaja vracenih u red cekanja            */
+    uint32_t        dropped;                                                    /**<@brief Broj unistenih dogadjaja, prostor je bio pun     */
+    uint_fast16_t   pending;                                                    /**<@brief Broj dogadjaja koji su trenutno preliveni        */
+} esEpaSpillStatus_T;
+
+/**@brief       Red odlozenih dogadjaja
+ * @details     Dogadjaji se cuvaju redom kojim su odlozeni. Red se prazni samo
+ *              pozivom esEvtRecall() i prilikom unistavanja EPA objekta.
+ * @notapi
+ */
+struct evtDefer {
+/**@brief       Bafer lokacija reda
+ */
+    struct evtDeferSlot * slot;
+
+/**@brief       Broj lokacija bafera
+ */
+    uint_fast16_t   levels;
+
+/**@brief       Broj odlozenih dogadjaja
+ */
+    uint_fast16_t   count;
+
+/**@brief       Statistika reda
+ */
+    esEpaDeferStatus_T status;
+};
+
 /**@brief       Red cekanja za dogadjaje.
  * @details     Ova struktura opisuje redove cekanja za dogadjaje koji se
  *              koriste za aktivne objekte. Red cekanja zajedno sa
@@ -98,26 +236,88 @@ typedef struct esEpaDef {
  *              brojace zauzeca reda za cekanje. @ref free pokazuje trenutni
  *              broj praznih lokacija dok @ref freeMin sadrzi najmanji broj
  *              slobodnih lokacija ikada.
+ *
+ *              Kada je ukljucena opcija @ref OPT_KERNEL_EVTQ_LOCKFREE red je
+ *              lock-free (MPSC): vise proizvodjaca (niti, prekidne rutine,
+ *              druga jezgra) upisuje dogadjaje bez kriticne sekcije, koristeci
+ *              C11 atomske operacije, a dogadjaje cita samo dispecer, uvek
+ *              unutar kriticne sekcije. Kapacitet reda se zaokruzuje na prvi
+ *              veci stepen dvojke. Brojac @c count se povecava tek nakon sto je
+ *              dogadjaj upisan. Proizvodjac koji ga poveca sa nule je duzan da
+ *              EPA objekat ubaci u red spremnih EPA objekata.
+ *
+ *              Kada vise proizvodjaca istovremeno upisuje, lokacija na pocetku
+ *              reda moze jos da se upisuje iako je @c count veci od nule.
+ *              Dispecer tada ne ceka unutar kriticne sekcije vec red smatra
+ *              praznim i postavlja @c isStalled. Proizvodjac koji zavrsi upis
+ *              i zatekne postavljen @c isStalled ponovo budi EPA objekat.
  * @notapi
  */
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE) || defined(__DOXYGEN__)
+struct evtQSlot;
+
+struct evtQueue {
+/**
+ * @brief       Bafer lokacija lock-free reda
+ */
+    struct evtQSlot * slot;
+
+/**
+ * @brief       Maska pozicije, kapacitet reda - 1
+ */
+    size_t          mask;
+
+/**
+ * @brief       Sledeca pozicija upisa, deli je vise proizvodjaca
+ */
+    atomic_size_t   tail;
+
+/**
+ * @brief       Sledeca pozicija citanja, koristi je samo dispecer
+ */
+    size_t          head;
+
+/**
+ * @brief       Broj dogadjaja u redu
+ */
+    atomic_size_t   count;
+
+/**
+ * @brief       Dispecer je zatekao neupisanu lokaciju na pocetku reda
+ */
+    atomic_bool     isStalled;
+
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+/**
+ * @brief       Najmanji broj slobodnih lokacija u redu za cekanje
+ */
+    atomic_size_t   freeMin;
+# endif
+};
+#else
 struct evtQueue {
 /**
  * @brief       Instanca reda za cekanje opste namene
  */
-    esQueuePtr_T    queue;
+# if (1U == OPT_KERNEL_EVTQ_POW2) || defined(__DOXYGEN__)
+    esQpPow2_T      queue;
+# else
+    esQp_T          queue;
+# endif
 
-#if defined(OPT_KERNEL_DBG_EVT) || defined(__DOXYGEN__)
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
 /**
  * @brief       Trenutni broj slobodnih lokacija u redu za cekanje
  */
-    uint_fast8_t    free;
+    uint_fast16_t   free;
 
 /**
  * @brief       Najmanji broj slobodnih lokacija u redu za cekanje
  */
-    uint_fast8_t    freeMin;
-#endif
+    uint_fast16_t   freeMin;
+# endif
 };
+#endif
 
 /**@extends     esSm
  * @brief       Zaglavlje Event Processing Agent objekta
@@ -137,15 +337,66 @@ struct esEpa {
  */
     struct evtQueue evtQueue;
 
+#if (1U == OPT_KERNEL_EVTQ_URGENT) || defined(__DOXYGEN__)
+/**@brief       Hitan red cekanja za dogadjaje.
+ * @details     Dispecer prazni ovaj red pre reda @ref evtQueue. Svaki red ima
+ *              svoje brojace zauzeca @c free i @c freeMin.
+ */
+    struct evtQueue evtUrgent;
+#endif
+
+/**@brief       Red odlozenih dogadjaja.
+ */
+    struct evtDefer evtDefer;
+
+#if (0U != OPT_KERNEL_EVT_SPILL) || defined(__DOXYGEN__)
+/**@brief       Statistika prelivanja dogadjaja.
+ * @details     Dok je @c pending vece od 0 novi dogadjaji se takodje prelivaju,
+ *              kako bi se ocuvao redosled.
+ */
+    esEpaSpillStatus_T evtSpill;
+#endif
+
 /**@brief       Prioritet EPA objekta.
- * @details     Ova promenljiva odredjuje prioritet datog EPA objekta.
+ * @details     Ova promenljiva odredjuje prioritet datog EPA objekta. Vise EPA
+ *              objekata moze imati isti prioritet.
+ */
+    uint_fast16_t   prio;
+
+/**@brief       Clan liste spremnih EPA objekata istog prioriteta
  */
-    uint_fast8_t    prio;
+    esDlsList_T     rdyList;
 
 /**@brief       Ime EPA objekta
  */
     const PORT_C_ROM char * name;
 
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX) || defined(__DOXYGEN__)
+/**@brief       Sledeci pretplatnik istog prioriteta
+ * @details     EPA objekti istog prioriteta koji su pretplaceni na barem jedan
+ *              signal cine jednostruko povezanu listu.
+ */
+    struct esEpa *  epnNext;
+
+/**@brief       Bitmapa signala na koje je EPA objekat pretplacen
+ */
+    portReg_T       epnSignal[ES_EPN_SIGNAL_WORDS];
+#endif
+
+#if (1U < OPT_KERNEL_CPU_NUM) || defined(__DOXYGEN__)
+/**@brief       Jezgro kome je EPA objekat dodeljen
+ * @details     EPA objekat se prijavljuje u bitmapu spremnih EPA objekata
+ *              ovog jezgra.
+ */
+    uint_fast8_t    cpu;
+
+/**@brief       Da li se EPA objekat trenutno izvrsava na nekom jezgru
+ * @details     Dok je ovaj indikator postavljen EPA objekat se ne nalazi ni u
+ *              jednoj bitmapi spremnih EPA objekata.
+ */
+    bool_T          isRunning;
+#endif
+
 #if defined(OPT_KERN_API_VALIDATION) || defined(__DOXYGEN__)
 /**@brief       Potpis koji pokazuje da je ovo zaista EPA objekat.
  */
@@ -153,6 +404,25 @@ struct esEpa {
 #endif
 };
 
+#if (1U == OPT_KERNEL_EVT_VALUE) || defined(__DOXYGEN__)
+/**@brief       Dogadjaj po vrednosti
+ * @details     Dispecer popunjava ovu strukturu iz reda cekanja pre poziva
+ *              funkcije stanja. Polja zaglavlja @c timestamp i @c generator
+ *              nisu popunjena. Struktura vazi samo dok se dogadjaj obradjuje,
+ *              pa funkcija stanja ne sme da cuva pokazivac na nju.
+ * @api
+ */
+typedef struct esEvtValue {
+/**@brief       Zaglavlje dogadjaja
+ */
+    esEvt_T         super;
+
+/**@brief       Vrednost koja je poslata uz dogadjaj
+ */
+    uintptr_t       value;
+} esEvtValue_T;
+#endif
+
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
@@ -186,6 +456,64 @@ void esEvtPostI(
     esEpa_T *       epa,
     esEvt_T *       evt);
 
+/**@brief       Pokusava da posalje dogadjaj na kraju reda za cekanje
+ * @param       epa
+ *              Pokazivac na EPA objekat kome se salje.
+ * @param       evt
+ *              Pokazivac na dogadjaj koji se salje.
+ * @return      Rezultat slanja.
+ *  @retval     EVT_POST_OK - dogadjaj je postavljen u red cekanja,
+ *  @retval     EVT_POST_FULL - red cekanja je pun.
+ * @details     Za razliku od esEvtPost() funkcije, dogadjaj se ne unistava
+ *              kada je red pun vec ostaje u vlasnistvu pozivaoca, koji moze da
+ *              ga posalje ponovo ili da ga unisti funkcijom esEvtDestroy().
+ *              Kada je @ref OPT_KERNEL_EVT_SPILL vece od 0 red se smatra punim
+ *              tek kada je pun i prostor za prelivanje.
+ * @api
+ */
+esEvtPostStatus_T esEvtTryPost(
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+/**@brief       Pokusava da posalje dogadjaj na kraju reda za cekanje
+ * @param       epa
+ *              Pokazivac na EPA objekat kome se salje.
+ * @param       evt
+ *              Pokazivac na dogadjaj koji se salje.
+ * @return      Rezultat slanja.
+ * @see         esEvtTryPost()
+ * @iclass
+ */
+esEvtPostStatus_T esEvtTryPostI(
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+#if defined(PORT_WAIT_UNTIL) || defined(__DOXYGEN__)
+/**@brief       Salje dogadjaj i ceka da se u redu cekanja oslobodi mesto
+ * @param       epa
+ *              Pokazivac na EPA objekat kome se salje.
+ * @param       evt
+ *              Pokazivac na dogadjaj koji se salje.
+ * @param       timeout
+ *              Najduze vreme cekanja u milisekundama.
+ * @return      Rezultat slanja.
+ *  @retval     EVT_POST_OK - dogadjaj je postavljen u red cekanja,
+ *  @retval     EVT_POST_TIMEOUT - vreme je isteklo, a red je i dalje pun.
+ * @details     Nit proizvodjaca se blokira dok dispecer ne uzme dogadjaje iz
+ *              reda cekanja ili dok ne istekne vreme. Kada vreme istekne
+ *              dogadjaj ostaje u vlasnistvu pozivaoca, kao kod esEvtTryPost().
+ *
+ *              Postoji samo na portovima koji mogu da blokiraju nit (na
+ *              primer POSIX host port) i sme se pozvati samo iz niti koja nije
+ *              dispecer kernela.
+ * @api
+ */
+esEvtPostStatus_T esEvtPostTimed(
+    esEpa_T *       epa,
+    esEvt_T *       evt,
+    uint32_t        timeout);
+#endif
+
 /**@brief       Salje dogadjaj na pocetku reda za cekanje (LIFO metod).
  * @param       epa
  *              Pokazivac na EPA objekat kome se salje.
@@ -196,6 +524,10 @@ void esEvtPostI(
  *              esEvtPost() funkcije dogadjaj se postavlja na pocetku reda za
  *              cekanje. Najcesce se koristi kada je potrebno da se EPA objektu
  *              hitno posalje neki dogadjaj od znacaja koji treba da obradi.
+ *
+ *              Kada je opcija @ref OPT_KERNEL_EVTQ_URGENT ukljucena dogadjaj
+ *              se postavlja na kraj hitnog reda cekanja (FIFO metod), koji se
+ *              obradjuje pre obicnog reda.
  * @api
  */
 void esEvtPostAhead(
@@ -218,6 +550,196 @@ void esEvtPostAheadI(
     esEpa_T *       epa,
     esEvt_T *       evt);
 
+/**@brief       Salje dogadjaj zamenom dogadjaja istog identifikatora
+ * @param       epa
+ *              Pokazivac na EPA objekat kome se salje.
+ * @param       evt
+ *              Pokazivac na dogadjaj koji se salje.
+ * @details     Ukoliko u redu cekanja vec postoji dogadjaj sa identifikatorom
+ *              <code>evt->id</code>, novi dogadjaj zauzima njegovo mesto, a
+ *              stari se unistava. Red tada ne raste i EPA objekat obradjuje
+ *              samo poslednji poslat dogadjaj. Ukoliko takvog dogadjaja nema,
+ *              dogadjaj se salje kao sa esEvtPost(). Pretrazuju se redom
+ *              hitan red (@ref OPT_KERNEL_EVTQ_URGENT), red cekanja i
+ *              preliveni dogadjaji EPA objekta (@ref OPT_KERNEL_EVT_SPILL),
+ *              tako da dogadjaj zadrzava mesto starog dogadjaja.
+ *
+ *              Namena je za signale kod kojih je bitna samo poslednja
+ *              vrednost, npr. ocitavanja senzora. Red se pretrazuje unutar
+ *              kriticne sekcije, pa vreme izvrsenja raste sa brojem dogadjaja
+ *              u redu. Kriticna sekcija se koristi i kada je ukljucena opcija
+ *              @ref OPT_KERNEL_EVTQ_LOCKFREE.
+ * @api
+ */
+void esEvtPostCoalesce(
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+/**@brief       Salje dogadjaj zamenom dogadjaja istog identifikatora
+ * @param       epa
+ *              Pokazivac na EPA objekat kome se salje.
+ * @param       evt
+ *              Pokazivac na dogadjaj koji se salje.
+ * @see         esEvtPostCoalesce()
+ * @iclass
+ */
+void esEvtPostCoalesceI(
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+#if (1U == OPT_KERNEL_EVT_VALUE) || defined(__DOXYGEN__)
+/**@brief       Salje dogadjaj po vrednosti na kraju reda za cekanje
+ * @param       epa
+ *              Pokazivac na EPA objekat kome se salje.
+ * @param       id
+ *              Identifikator dogadjaja, ne sme da koristi najvisi bit
+ *              @c uintptr_t tipa.
+ * @param       value
+ *              Vrednost koja se salje uz dogadjaj.
+ * @details     Dogadjaj se ne kreira, vec se identifikator i vrednost
+ *              upisuju direktno u red cekanja. Funkcija stanja dobija
+ *              pokazivac na esEvt_T, a vrednost cita pomocu
+ *              @ref ES_EVT_VALUE_GET. Ako je red pun dogadjaj se odbacuje.
+ * @api
+ */
+void esEvtPostValue(
+    esEpa_T *       epa,
+    esEvtId_T       id,
+    uintptr_t       value);
+
+/**@brief       Salje dogadjaj po vrednosti na kraju reda za cekanje
+ * @param       epa
+ *              Pokazivac na EPA objekat kome se salje.
+ * @param       id
+ *              Identifikator dogadjaja.
+ * @param       value
+ *              Vrednost koja se salje uz dogadjaj.
+ * @see         esEvtPostValue()
+ * @iclass
+ */
+void esEvtPostValueI(
+    esEpa_T *       epa,
+    esEvtId_T       id,
+    uintptr_t       value);
+#endif
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Odlozeni dogadjaji
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Vraca odlozene dogadjaje u red cekanja
+ * @param       epa
+ *              Pokazivac na EPA objekat.
+ * @return      Broj dogadjaja koji su vraceni u red cekanja.
+ * @details     Dogadjaji se postavljaju na pocetak reda cekanja, redom kojim
+ *              su odlozeni, tako da se najstariji odlozen dogadjaj obradjuje
+ *              prvi. Obicno se poziva pri ulasku u stanje koje moze da obradi
+ *              odlozene dogadjaje. Dogadjaji za koje nema mesta ostaju u redu
+ *              odlozenih dogadjaja.
+ *
+ *              Kada je ukljucena opcija @ref OPT_KERNEL_EVTQ_LOCKFREE
+ *              dogadjaji se postavljaju na kraj reda cekanja.
+ * @api
+ */
+size_t esEvtRecall(
+    esEpa_T *       epa);
+
+/**@brief       Vraca odlozene dogadjaje u red cekanja
+ * @param       epa
+ *              Pokazivac na EPA objekat.
+ * @return      Broj dogadjaja koji su vraceni u red cekanja.
+ * @see         esEvtRecall()
+ * @iclass
+ */
+size_t esEvtRecallI(
+    esEpa_T *       epa);
+
+/**@brief       Dobavlja statistiku reda odlozenih dogadjaja
+ * @param       epa
+ *              Pokazivac na EPA objekat.
+ * @param       [out] status
+ *              Struktura u koju se upisuje statistika.
+ * @details     Bez reda odlozenih dogadjaja, odlozen dogadjaj se ponovo salje
+ *              i obradjuje iznova sve dok se stanje ne promeni. Procena
+ *              @c saved broji po jednu obradu za svaki dogadjaj koji je cekao
+ *              u redu odlozenih dogadjaja dok je EPA objekat obradio neki drugi
+ *              dogadjaj. To je donja granica, jer bez drugih dogadjaja ponovno
+ *              slanje zauzima procesor neograniceno.
+ * @api
+ */
+void esEpaDeferStatusGet(
+    const esEpa_T * epa,
+    esEpaDeferStatus_T * status);
+
+#if (0U != OPT_KERNEL_EVT_SPILL) || defined(__DOXYGEN__)
+/**@brief       Dobavlja statistiku prelivanja dogadjaja EPA objekta
+ * @param       epa
+ *              Pokazivac na EPA objekat.
+ * @param       [out] status
+ *              Struktura u koju se upisuje statistika.
+ * @api
+ */
+void esEpaSpillStatusGet(
+    const esEpa_T * epa,
+    esEpaSpillStatus_T * status);
+#endif
+
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX) || defined(__DOXYGEN__)
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Event Processing Network (EPN)
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Pretplacuje EPA objekat na signal
+ * @param       epa
+ *              Pokazivac na EPA objekat koji se pretplacuje.
+ * @param       id
+ *              Identifikator signala, mora biti manji od
+ *              @ref OPT_KERNEL_EPN_SIGNAL_MAX.
+ * @details     Vise EPA objekata istog prioriteta moze biti pretplaceno na
+ *              isti signal. Objavljivanje tada prolazi kroz listu pretplatnika
+ *              tog prioriteta, pa je cena objavljivanja srazmerna broju EPA
+ *              objekata koji dele prioritet.
+ * @api
+ */
+void esEpnSubscribe(
+    esEpa_T *       epa,
+    esEvtId_T       id);
+
+/**@brief       Ukida pretplatu EPA objekta na signal
+ * @param       epa
+ *              Pokazivac na EPA objekat.
+ * @param       id
+ *              Identifikator signala.
+ * @api
+ */
+void esEpnUnsubscribe(
+    esEpa_T *       epa,
+    esEvtId_T       id);
+
+/**@brief       Objavljuje dogadjaj svim pretplatnicima
+ * @param       evt
+ *              Pokazivac na dogadjaj koji se objavljuje.
+ * @details     Dogadjaj se u jednoj kriticnoj sekciji postavlja u redove
+ *              cekanja svih EPA objekata koji su pretplaceni na
+ *              <code>evt->id</code>, pocevsi od pretplatnika najviseg
+ *              prioriteta. Brojac korisnika dogadjaja se povecava samo jednom,
+ *              za ukupan broj pretplatnika koji su primili dogadjaj. Dogadjaj
+ *              koji nema ni jednog pretplatnika se unistava.
+ * @api
+ */
+void esEvtPublish(
+    esEvt_T *       evt);
+
+/**@brief       Objavljuje dogadjaj svim pretplatnicima
+ * @param       evt
+ *              Pokazivac na dogadjaj koji se objavljuje.
+ * @see         esEvtPublish()
+ * @iclass
+ */
+void esEvtPublishI(
+    esEvt_T *       evt);
+#endif
+
 /** @} *//*---------------------------------------------------------------*//**
  * @name        Osnovne funkcije za menadzment EPA objekata
  * @{ *//*--------------------------------------------------------------------*/
@@ -263,7 +785,7 @@ esEpa_T * esEpaGet(
  * @return      Trenutni prioritet EPA objekta.
  * @api
  */
-uint8_t esEpaPrioGet(
+uint16_t esEpaPrioGet(
     const esEpa_T * epa);
 
 /**@brief       Postavlja nov prioritet EPA objekta.
@@ -271,13 +793,13 @@ uint8_t esEpaPrioGet(
  *              Pokazivac na EPA objekat.
  * @param       newPrio
  *              Nov prioritet EPA objekta.
- * @warning     Ukoliko je zahtevani prioritet vec zauzet javice se assert
- *              obavestenje.
+ * @details     Ukoliko je EPA objekat spreman za izvrsenje on se premesta na
+ *              kraj reda spremnih EPA objekata novog prioriteta.
  * @api
  */
 void esEpaPrioSet(
     esEpa_T *       epa,
-    uint8_t         newPrio);
+    uint16_t        newPrio);
 
 /** @} *//*-----------------------------------------------  C++ extern end  --*/
 #ifdef __cplusplus
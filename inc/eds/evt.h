@@ -42,6 +42,14 @@
 #include "base/mem.h"
 #include "eds/evt_cfg.h"
 
+#if (0U == OPT_MEM_POOL_EXTERN) && (1U == OPT_MEM_POOL_LOCKFREE)
+# include "primitive/lfpool.h"
+#endif
+
+#if (0U == OPT_MEM_DYN_EXTERN) && (1U == OPT_MEM_DYN_TLSF)
+# include "eds/tlsf.h"
+#endif
+
 /*===============================================================  DEFINES  ==*/
 
 /*------------------------------------------------------------------------*//**
@@ -67,6 +75,15 @@
  */
 #define EVT_CONST_Msk                   ((uint_fast16_t)(1u << 15))
 
+/**@brief       Bit mask which defines a value event
+ * @details     Value events are not created, they are carried by the event
+ *              queue and rebuilt by the dispatcher, see esEvtPostValue(). The
+ *              bit is meaningful only together with @ref EVT_CONST_Msk since
+ *              constant events do not use the user counter bits.
+ * @api
+ */
+#define EVT_VALUE_Msk                   ((uint_fast16_t)(1u << 13))
+
 /** @} *//*-------------------------------------------------------------------*/
 
 /*===============================================================  MACRO's  ==*/
@@ -131,6 +148,9 @@ CFG_EVT_STRUCT_ATTRIB struct esEvt {
 #if (1 == CFG_EVT_USE_SIZE) || defined(__DOXYGEN__)
     esEvtSize_T         size;                                                   /**<@brief Event size in bytes, see @ref CFG_EVT_SIZE_TYPE     */
 #endif
+#if (2 > CFG_EVT_STORAGE) || defined(__DOXYGEN__)
+    OPT_MEM_POOL_T *    pool;                                                   /**<@brief Origin pool, NULL if allocated from the heap     */
+#endif
 #if (1 == CFG_DBG_API_VALIDATION) || defined(__DOXYGEN__)
     portReg_T           signature;                                              /**<@brief Structure signature, used during development only*/
 #endif
@@ -141,6 +161,22 @@ CFG_EVT_STRUCT_ATTRIB struct esEvt {
  */
 typedef struct esEvt esEvt_T;
 
+#if ((2 > CFG_EVT_STORAGE) && (0 != CFG_EVT_MAG_SIZE)) || defined(__DOXYGEN__)
+/**@brief       Magazine cache statistics of one CPU
+ * @details     A hit is a request served by the magazine alone. A miss is a
+ *              request which had to refill or flush the magazine. Requests
+ *              which found the magazine in use and went directly to the pool
+ *              are not counted.
+ * @api
+ */
+typedef struct esEvtMagStatus {
+    uint32_t            allocHit;                                               /**<@brief Number of blocks taken from the magazine         */
+    uint32_t            allocMiss;                                              /**<@brief Number of allocations which accessed the pool    */
+    uint32_t            freeHit;                                                /**<@brief Number of blocks stored in the magazine          */
+    uint32_t            freeMiss;                                               /**<@brief Number of deallocations which accessed the pool  */
+} esEvtMagStatus_T;
+#endif
+
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
@@ -149,10 +185,25 @@ typedef struct esEvt esEvt_T;
  * @{ *//*--------------------------------------------------------------------*/
 
 void esEvtPoolRegister(
-    esPMemHandle_T *    handle);
+    OPT_MEM_POOL_T *    handle);
 
 void esEvtPoolUnregister(
-    esPMemHandle_T *    handle);
+    OPT_MEM_POOL_T *    handle);
+
+#if ((2 > CFG_EVT_STORAGE) && (0 != CFG_EVT_MAG_SIZE)) || defined(__DOXYGEN__)
+/**@brief       Dobavlja statistiku magacina jednog jezgra
+ * @param       cpu
+ *              Identifikator jezgra, manji od @ref OPT_KERNEL_CPU_NUM.
+ * @param       [out] status
+ *              Struktura u koju se upisuje statistika.
+ * @details     Brojaci se citaju bez sinhronizacije sa jezgrom koje ih menja,
+ *              pa su namenjeni samo za pracenje rada sistema.
+ * @api
+ */
+void esEvtMagStatusGet(
+    uint_fast8_t        cpu,
+    esEvtMagStatus_T *  status);
+#endif
 
 /**@} *//*----------------------------------------------------------------*//**
  * @name        Kreiranje/brisanje dogadjaja
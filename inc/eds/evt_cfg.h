@@ -101,7 +101,7 @@
  * @note        Podrazumevano podesavanje: 0 (dogadjaji ne koriste atribut o
  *              generatoru)
  */
-#if !defined(OPT_EVT_USE_GENERATOR)
+#if !defined(CFG_EVT_USE_GENERATOR)
 # define CFG_EVT_USE_GENERATOR          1
 #endif
 
@@ -115,7 +115,7 @@
  * @note        Podrazumevano podesavanje: 0 (dogadjaji ne koriste atribut o
  *              vremenskom markeru)
  */
-#if !defined(OPT_EVT_USE_TIMESTAMP)
+#if !defined(CFG_EVT_USE_TIMESTAMP)
 # define CFG_EVT_USE_TIMESTAMP          1
 #endif
 
@@ -191,7 +191,7 @@
  * @note        Podrazumevano podesavanje: 0 (ne koristi se callback funkcija)
  */
 #if !defined(OPT_EVT_GENERATOR_CALLBACK)
-# define OPT_EVT_GENERATOR_CALLBACK     1U
+# define OPT_EVT_GENERATOR_CALLBACK     0U
 #endif
 
 /**
@@ -209,7 +209,7 @@
  * @note        Podrazumevano podesavanje: 0 (ne koristi se callback funkcija)
  */
 #if !defined(OPT_EVT_TIMESTAMP_CALLBACK)
-# define OPT_EVT_TIMESTAMP_CALLBACK     1U
+# define OPT_EVT_TIMESTAMP_CALLBACK     0U
 #endif
 
 /**@} *//*----------------------------------------------------------------*//**
@@ -286,7 +286,9 @@ typedef uint32_t                        esEvtTime_T;
  *
  *              When option `0` is chosen eSolid will try to use pools for
  *              event storage. If an event can not be allocated in event pools
- *              it will call dynamic memory allocators.
+ *              it will call dynamic memory allocators. With options `0` and
+ *              `1` each event header records the pool it was taken from, so a
+ *              destroyed event is always returned to its own allocator.
  *              Default: 0 (use pools and dynamic memory)
  */
 #if !defined(CFG_EVT_STORAGE)
@@ -301,6 +303,47 @@ typedef uint32_t                        esEvtTime_T;
 # define CFG_EVT_STORAGE_NPOOL          4
 #endif
 
+/**@brief       Size class granularity of event pools, expressed as power of two
+ * @details     When pool memory is being used for storage, the requested event
+ *              size is rounded up to a multiple of <code>2^SHIFT</code> bytes
+ *              and used as an index into a table which holds the smallest
+ *              fitting pool for each size class. The table is rebuilt each time
+ *              a pool is registered or unregistered, so the pool is found in
+ *              constant time when an event is created. The best fitting pool is
+ *              always selected, but the lookup is constant only when there is
+ *              at most one pool block size inside each granule.
+ */
+#if !defined(CFG_EVT_STORAGE_CLASS_SHIFT)
+# define CFG_EVT_STORAGE_CLASS_SHIFT    2
+#endif
+
+/**@brief       The largest event size which is covered by the size class table
+ * @details     Events larger than this size are matched against the registered
+ *              pools by searching the pool list. The size class table holds one
+ *              pointer for each size class up to this size.
+ */
+#if !defined(CFG_EVT_STORAGE_CLASS_MAX)
+# define CFG_EVT_STORAGE_CLASS_MAX      128
+#endif
+
+/**@brief       Specifies the number of free event blocks cached per pool on
+ *              each CPU
+ * @details     When pool memory is being used for storage each kernel CPU can
+ *              keep a magazine of free blocks for every registered pool. Events
+ *              are then created and destroyed by pushing and popping pointers
+ *              in a CPU local magazine. The magazine is refilled from and
+ *              flushed to the pool in batches of half of its size. An interrupt
+ *              or a host thread which finds the magazine in use goes directly
+ *              to the pool. Requires a C11 compiler.
+ *              - 0 - magazines are not used
+ *              - n - each magazine caches up to n blocks
+ *
+ *              Default: 0 (magazines are not used)
+ */
+#if !defined(CFG_EVT_MAG_SIZE)
+# define CFG_EVT_MAG_SIZE               0
+#endif
+
 /**@} *//*--------------------------------------------------------------------*/
 
 /*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
@@ -313,7 +356,7 @@ typedef uint32_t                        esEvtTime_T;
 # error "eSolid: EVT: Event size type is not properly set"
 #endif
 
-#if (2 < CFG_EVT_TIMESTAMP_TYPE) && (1 == CFG_EVT_USE_TIMESTAMP),
+#if (2 < CFG_EVT_TIMESTAMP_TYPE) && (1 == CFG_EVT_USE_TIMESTAMP)
 # error "eSolid: EVT: Event timestamp type is not properly set"
 #endif
 
@@ -321,6 +364,22 @@ typedef uint32_t                        esEvtTime_T;
 # error "eSolid: EVT: Option OPT_EVT_TIMESTAMP_CALLBACK is enabled while option OPT_EVT_USE_TIMESTAMP is disabled. Enable option OPT_EVT_TIMESTAMP_CALLBACK only if you use timestamp."
 #endif
 
+#if (2 > CFG_EVT_STORAGE) && ((1 << CFG_EVT_STORAGE_CLASS_SHIFT) > CFG_EVT_STORAGE_CLASS_MAX)
+# error "eSolid: EVT: Option CFG_EVT_STORAGE_CLASS_MAX must be at least one size class granule (2^CFG_EVT_STORAGE_CLASS_SHIFT bytes)."
+#endif
+
+#if (0 != CFG_EVT_MAG_SIZE) && (2 <= CFG_EVT_STORAGE)
+# error "eSolid: EVT: Option CFG_EVT_MAG_SIZE can be used only when pool storage is used (CFG_EVT_STORAGE 0 or 1)."
+#endif
+
+#if (255 < CFG_EVT_MAG_SIZE)
+# error "eSolid: EVT: Option CFG_EVT_MAG_SIZE must not be greater than 255."
+#endif
+
+#if (2 > CFG_EVT_STORAGE) && (255 < CFG_EVT_STORAGE_NPOOL)
+# error "eSolid: EVT: Option CFG_EVT_STORAGE_NPOOL must not be greater than 255."
+#endif
+
 #if (1 == OPT_EVT_GENERATOR_CALLBACK) && (0 == CFG_EVT_USE_GENERATOR)
 # error "eSolid: EVT: Option OPT_EVT_GENERATOR_CALLBACK is enabled while option OPT_EVT_USE_GENERATOR is disabled. Enable option OPT_EVT_GENERATOR_CALLBACK only if you use generator."
 #endif
@@ -48,6 +48,7 @@
 /*=========================================================  INCLUDE FILES  ==*/
 
 #include "eds/core.h"
+#include "eds/tem.h"
 
 /*===============================================================  MACRO's  ==*/
 
@@ -81,7 +82,7 @@
 # define ES_KERN_ASSERT(num, expr)                                              \
     do {                                                                        \
         if (!(expr)) {                                                          \
-            userAssert(C_FUNC, #num, #expr);                                    \
+            userAssert(PORT_C_FUNC, #num, #expr);                               \
         }                                                                       \
     } while (0U)
 
@@ -82,6 +82,204 @@
 #define ES_STATE_IGNORED()                                                     \
     (RETN_IGNORED)
 
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Kes putanja tranzicija
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Deklarise kes putanja tranzicija HSM automata
+ * @param       name                    Ime kes objekta,
+ * @param       size                    broj parova (izvoriste, odrediste) koji
+ *                                      se pamte,
+ * @param       levels                  maksimalna dubina hijerarhije stanja
+ *                                      automata, ista kao @c smLevels.
+ * @details     Makro deklarise memoriju kesa i objekat @c name tipa
+ *              esSmTranCache_T. Adresa objekta se upisuje u clan
+ *              @c smTranCache definicione strukture automata.
+ * @note        Koristi se samo kada je opcija @ref OPT_SMP_TRAN_CACHE
+ *              ukljucena.
+ */
+#define ES_SM_TRAN_CACHE(name, size, levels)                                   \
+    static struct esSmTranLine name ## Line_[(size)];                          \
+    static esState_T name ## Path_[(size) * (levels) * 2U];                    \
+    esSmTranCache_T name = {                                                   \
+        name ## Line_,                                                         \
+        name ## Path_,                                                         \
+        (size),                                                                \
+        (levels),                                                              \
+        0U,                                                                    \
+        0U                                                                     \
+    }
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Staticke tabele hijerarhije stanja
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Indeks najviseg stanja (esSmTopState) u tabeli hijerarhije
+ */
+#define ES_SM_TOP_IDX                   0U
+
+/**
+ * @brief       Pocinje deklaraciju tabele hijerarhije stanja
+ * @param       name                    Ime tabele.
+ * @details     Prvi clan tabele, sa indeksom @ref ES_SM_TOP_IDX, je
+ *              esSmTopState() i dodaje ga ovaj makro. Nakon makroa se navode
+ *              stanja makroom ES_SM_STATE(), a deklaracija se zavrsava makroom
+ *              ES_SM_STATE_TABLE_END(). Primer:
+ * @code
+ * ES_SM_STATE_TABLE_BEGIN(appTable)
+ *     ES_SM_STATE(&stateIdle, ES_SM_TOP_IDX, 1U),
+ *     ES_SM_STATE(&stateRun,  ES_SM_TOP_IDX, 1U),
+ *     ES_SM_STATE(&stateFast, 2U,            2U)
+ * ES_SM_STATE_TABLE_END(appTable);
+ * @endcode
+ * @note        Koristi se samo kada je opcija @ref OPT_SMP_STATE_TABLE
+ *              ukljucena.
+ */
+#define ES_SM_STATE_TABLE_BEGIN(name)                                          \
+    static const PORT_C_ROM struct esSmStateDesc name ## Desc_[] = {           \
+        ES_SM_STATE_MASK(&esSmTopState, ES_SM_TOP_IDX, 0U, 0U),
+
+/**
+ * @brief       Opisuje jedno stanje u tabeli hijerarhije
+ * @param       handler                 Funkcija stanja,
+ * @param       parent                  indeks super stanja u tabeli, super
+ *                                      stanje mora biti navedeno pre stanja,
+ * @param       depth                   dubina stanja, za jedan veca od dubine
+ *                                      super stanja. Stanja cije je super
+ *                                      stanje esSmTopState() imaju dubinu 1.
+ * @details     Smatra se da stanje obradjuje sve signale.
+ */
+#define ES_SM_STATE(handler, parent, depth)                                    \
+    ES_SM_STATE_MASK(handler, parent, depth, ES_SM_MASK_ALL)
+
+/**
+ * @brief       Opisuje jedno stanje sa maskom obradjenih signala
+ * @param       handler                 Funkcija stanja,
+ * @param       parent                  indeks super stanja u tabeli,
+ * @param       depth                   dubina stanja,
+ * @param       mask                    maska signala koje stanje obradjuje,
+ *                                      sastavljena makroom ES_SM_SIG().
+ * @details     Maska mora da sadrzi svaki signal za koji funkcija stanja vraca
+ *              nesto drugo osim RETN_SUPER. Signali sa identifikatorom vecim ili
+ *              jednakim @ref ES_SM_MASK_BITS se uvek salju funkciji stanja.
+ *              Kada je opcija @ref OPT_SMP_STATE_MASK iskljucena maska se
+ *              zanemaruje.
+ */
+#if (1U == OPT_SMP_STATE_MASK) || defined(__DOXYGEN__)
+# define ES_SM_STATE_MASK(handler, parent, depth, mask)                         \
+    {(esState_T)(handler), (esSmMask_T)(mask), (uint8_t)(parent), (uint8_t)(depth)}
+#else
+# define ES_SM_STATE_MASK(handler, parent, depth, mask)                         \
+    {(esState_T)(handler), (uint8_t)(parent), (uint8_t)(depth)}
+#endif
+
+/**
+ * @brief       Broj signala koje maska moze da opise
+ */
+#define ES_SM_MASK_BITS                 32U
+
+/**
+ * @brief       Maska koja sadrzi sve signale
+ */
+#define ES_SM_MASK_ALL                  UINT32_C(0xFFFFFFFF)
+
+/**
+ * @brief       Bit maske za signal @c id
+ */
+#define ES_SM_SIG(id)                                                          \
+    ((esSmMask_T)1U << (id))
+
+/**
+ * @brief       Zavrsava deklaraciju tabele hijerarhije stanja
+ * @param       name                    Ime tabele, isto kao u
+ *                                      ES_SM_STATE_TABLE_BEGIN().
+ * @details     Makro deklarise objekat @c name tipa esSmStateTable_T cija se
+ *              adresa upisuje u clan @c smStateTable definicione strukture
+ *              automata.
+ */
+#define ES_SM_STATE_TABLE_END(name)                                            \
+    };                                                                         \
+    const PORT_C_ROM esSmStateTable_T name = {                                 \
+        name ## Desc_,                                                         \
+        (uint8_t)(sizeof(name ## Desc_) / sizeof(name ## Desc_[0]))            \
+    }
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Tabele prelaza FSM automata
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Pocinje deklaraciju tabele prelaza
+ * @param       name                    Ime tabele,
+ * @param       states                  broj stanja, najvise 254,
+ * @param       signals                 broj signala, identifikatori dogadjaja
+ *                                      veci ili jednaki ovoj vrednosti se
+ *                                      ignorisu.
+ * @details     Nakon makroa se za svako stanje navodi ES_SM_TABLE_ROW() sa
+ *              listom celija ES_SM_TABLE_TRAN() i ES_SM_TABLE_ACTION().
+ *              Izostavljene celije znace da se dogadjaj ignorise. Primer:
+ * @code
+ * ES_SM_TABLE_BEGIN(ledTable, 2U, SIG_LAST)
+ *     ES_SM_TABLE_ROW(LED_OFF) {
+ *         ES_SM_TABLE_TRAN(SIG_TOGGLE, &ledOn, LED_ON)
+ *     },
+ *     ES_SM_TABLE_ROW(LED_ON) {
+ *         ES_SM_TABLE_TRAN(SIG_TOGGLE, &ledOff, LED_OFF),
+ *         ES_SM_TABLE_ACTION(SIG_BLINK, &ledBlink)
+ *     }
+ * ES_SM_TABLE_END(ledTable, 2U, SIG_LAST, LED_OFF);
+ * @endcode
+ * @note        Koristi se samo kada je @ref OPT_SMP_SM_TYPES jednako
+ *              @ref ES_SMP_FSM_TABLE.
+ */
+#define ES_SM_TABLE_BEGIN(name, states, signals)                               \
+    static const PORT_C_ROM struct esSmTableCell                               \
+        name ## Cell_[(states)][(signals)] = {
+
+/**
+ * @brief       Pocinje red tabele prelaza za stanje @c state
+ */
+#define ES_SM_TABLE_ROW(state)                                                 \
+    [(state)] =
+
+/**
+ * @brief       Celija sa tranzicijom
+ * @param       signal                  Identifikator dogadjaja,
+ * @param       action                  akcija koja se izvrsava pre tranzicije
+ *                                      ili NULL,
+ * @param       next                    naredno stanje.
+ */
+#define ES_SM_TABLE_TRAN(signal, action, next)                                 \
+    [(signal)] = {(esSmAction_T)(action), (uint8_t)((next) + 1U)}
+
+/**
+ * @brief       Celija sa akcijom bez promene stanja
+ * @param       signal                  Identifikator dogadjaja,
+ * @param       action                  akcija koja se izvrsava.
+ */
+#define ES_SM_TABLE_ACTION(signal, action)                                     \
+    [(signal)] = {(esSmAction_T)(action), 0U}
+
+/**
+ * @brief       Zavrsava deklaraciju tabele prelaza
+ * @param       name                    Ime tabele,
+ * @param       states                  broj stanja,
+ * @param       signals                 broj signala,
+ * @param       init                    inicijalno stanje automata.
+ * @details     Makro deklarise objekat @c name tipa esSmTable_T cija se adresa
+ *              upisuje u clan @c smTable definicione strukture automata.
+ */
+#define ES_SM_TABLE_END(name, states, signals, init)                           \
+    };                                                                         \
+    const PORT_C_ROM esSmTable_T name = {                                      \
+        &name ## Cell_[0][0],                                                  \
+        (uint8_t)(states),                                                     \
+        (uint8_t)(signals),                                                    \
+        (uint8_t)(init)                                                        \
+    }
+
 /** @} *//*---------------------------------------------  C++ extern begin  --*/
 #ifdef __cplusplus
 extern "C" {
@@ -142,6 +340,43 @@ enum esEvtId {
  */
 typedef uint_fast8_t esStatus_T;
 
+/**
+ * @brief       Odgovori state handler funkcija dispeceru
+ * @api
+ */
+enum esStatusCode {
+/**
+ * @brief       Dogadjaj je obradjen i ne treba izvrsiti promenu stanja.
+ */
+    RETN_HANDLED,
+
+/**
+ * @brief       Dogadjaj treba odloziti i obraditi nakon promene stanja.
+ */
+    RETN_DEFERRED,
+
+/**
+ * @brief       Treba izvrsiti tranziciju ka stanju upisanom u automat.
+ */
+    RETN_TRAN,
+
+/**
+ * @brief       Pristigli dogadjaj nije obradjen i ignorisan je.
+ * @details     Obicno se ovakav odgovor u top state-u automata i koristi se u
+ *              svrhe debagiranja sistema. Dogadjaj se brise iz sistema ako nema
+ *              jos korisnika.
+ */
+    RETN_IGNORED,
+
+/**
+ * @brief       Vraca se koje je super stanje date state handler funkcije.
+ * @details     Ova vrednost se vraca kada state handler funkcija ne zna da
+ *              obradi neki dogadjaj ili je od nje zahtevano da vrati koje je
+ *              njeno super stanje.
+ */
+    RETN_SUPER
+};
+
 /**
  * @brief       Tip state handler funkcija.
  * @details     State handler funkcije vracaju esStatus_T , a kao parametar
@@ -159,6 +394,129 @@ typedef esStatus_T (* esState_T) (void *, esEvt_T *);
  */
 typedef struct esSm esSm_T;
 
+/**
+ * @brief       Jedan red kesa putanja tranzicija
+ * @details     Red pamti tranziciju iz stanja @c src u stanje @c dst. Prvih
+ *              @c nExit clanova pridruzene putanje su stanja za izlaz od
+ *              izvorista navise, a narednih @c nEntry clanova su stanja za ulaz
+ *              od deteta najblizeg zajednickog pretka (LCA) do odredista.
+ * @notapi
+ */
+struct esSmTranLine {
+    esState_T       src;                                                        /**<@brief Izvorisno stanje tranzicije                      */
+    esState_T       dst;                                                        /**<@brief Odredisno stanje tranzicije                      */
+    uint8_t         nExit;                                                      /**<@brief Broj stanja za izlaz                             */
+    uint8_t         nEntry;                                                     /**<@brief Broj stanja za ulaz                              */
+};
+
+/**
+ * @brief       Kes putanja tranzicija HSM automata
+ * @details     Kes je direktno mapiran: par (izvoriste, odrediste) se
+ *              preslikava u jedan red, a novi par istiskuje stari. Deklarise
+ *              se makroom ES_SM_TRAN_CACHE().
+ * @api
+ */
+typedef struct esSmTranCache {
+    struct esSmTranLine * line;                                                 /**<@brief Redovi kesa                                      */
+    esState_T *     path;                                                       /**<@brief Putanje, 2 * levels stanja po redu               */
+    uint_fast16_t   size;                                                       /**<@brief Broj redova kesa                                 */
+    uint8_t         levels;                                                     /**<@brief Maksimalna dubina hijerarhije                    */
+    uint32_t        hit;                                                        /**<@brief Broj tranzicija pronadjenih u kesu               */
+    uint32_t        miss;                                                       /**<@brief Broj tranzicija koje su trazene SIG_SUPER        */
+} esSmTranCache_T;
+
+/**
+ * @brief       Maska signala koje stanje obradjuje
+ * @details     Bit @c i je postavljen ako stanje obradjuje dogadjaj sa
+ *              identifikatorom @c i.
+ * @api
+ */
+typedef uint32_t esSmMask_T;
+
+/**
+ * @brief       Opis jednog stanja u tabeli hijerarhije
+ * @notapi
+ */
+struct esSmStateDesc {
+    esState_T       handler;                                                    /**<@brief Funkcija stanja                                  */
+#if (1U == OPT_SMP_STATE_MASK) || defined(__DOXYGEN__)
+    esSmMask_T      mask;                                                       /**<@brief Signali koje stanje obradjuje                    */
+#endif
+    uint8_t         parent;                                                     /**<@brief Indeks super stanja u tabeli                     */
+    uint8_t         depth;                                                      /**<@brief Dubina stanja, esSmTopState ima dubinu 0         */
+};
+
+/**
+ * @brief       Staticka tabela hijerarhije stanja HSM automata
+ * @details     Deklarise se makroima ES_SM_STATE_TABLE_BEGIN(), ES_SM_STATE()
+ *              i ES_SM_STATE_TABLE_END().
+ * @api
+ */
+typedef struct esSmStateTable {
+    const PORT_C_ROM struct esSmStateDesc * state;                              /**<@brief Opisi stanja                                     */
+    uint8_t         size;                                                       /**<@brief Broj stanja u tabeli                             */
+} esSmStateTable_T;
+
+/**
+ * @brief       Tip akcije u tabeli prelaza
+ * @details     Akcija prihvata pokazivac na korisnicke podatke automata i
+ *              pokazivac na dogadjaj koji se obradjuje.
+ * @api
+ */
+typedef void (* esSmAction_T) (void *, const esEvt_T *);
+
+/**
+ * @brief       Jedna celija tabele prelaza
+ * @details     Clan @c next cuva naredno stanje uvecano za jedan, tako da
+ *              celija popunjena nulama znaci da se dogadjaj ignorise.
+ * @notapi
+ */
+struct esSmTableCell {
+    esSmAction_T    action;                                                     /**<@brief Akcija ili NULL                                  */
+    uint8_t         next;                                                       /**<@brief Naredno stanje + 1, ili 0 bez tranzicije         */
+};
+
+/**
+ * @brief       Tabela prelaza FSM automata
+ * @details     Celije su gusto smestene po redovima: celija za stanje @c s i
+ *              signal @c i je <code>cell[s * signals + i]</code>. Deklarise se
+ *              makroima ES_SM_TABLE_BEGIN() i ES_SM_TABLE_END().
+ * @api
+ */
+typedef struct esSmTable {
+    const PORT_C_ROM struct esSmTableCell * cell;                               /**<@brief Celije tabele                                    */
+    uint8_t         states;                                                     /**<@brief Broj stanja                                      */
+    uint8_t         signals;                                                    /**<@brief Broj signala                                     */
+    uint8_t         init;                                                       /**<@brief Inicijalno stanje                                */
+} esSmTable_T;
+
+/**
+ * @brief       Skup FSM automata zadatih istom tabelom prelaza
+ * @details     Automati su smesteni kao struktura nizova: stanje svakog
+ *              automata je jedan bajt u nizu @c state, a korisnicki podaci su
+ *              @c dataSize bajtova u nizu @c data. Automat se referencira
+ *              indeksom, tako da skup od @c size automata zauzima
+ *              <code>size * (1 + dataSize)</code> bajtova. Memoriju obezbedjuje
+ *              aplikacija, a skup se inicijalizuje funkcijom esSmPoolInit().
+ * @api
+ */
+typedef struct esSmPool {
+    const PORT_C_ROM esSmTable_T * table;                                       /**<@brief Tabela prelaza zajednicka za sve automate        */
+    uint8_t *       state;                                                      /**<@brief Stanja automata                                  */
+    uint8_t *       data;                                                       /**<@brief Korisnicki podaci automata                       */
+    size_t          dataSize;                                                   /**<@brief Velicina korisnickih podataka jednog automata    */
+    uint32_t        size;                                                       /**<@brief Broj automata u skupu                            */
+} esSmPool_T;
+
+/**
+ * @brief       Statistika kesa putanja tranzicija
+ * @api
+ */
+typedef struct esSmTranCacheStatus {
+    uint32_t        hit;                                                        /**<@brief Broj tranzicija pronadjenih u kesu               */
+    uint32_t        miss;                                                       /**<@brief Broj tranzicija koje su trazene SIG_SUPER        */
+} esSmTranCacheStatus_T;
+
 /**
  * @brief       Definiciona struktura koja opisuje jedan SMP objekat
  * @details     Ova struktura se koristi prilikom kreiranja novog SMP objekta.
@@ -182,20 +540,45 @@ typedef struct esSmDef {
  * @brief       Maksimalna dubina hijerarhije stanja automata.
  */
     uint8_t         smLevels;
+
+/**
+ * @brief       Kes putanja tranzicija
+ * @details     Koristi se samo kada je opcija @ref OPT_SMP_TRAN_CACHE
+ *              ukljucena. Vrednost NULL iskljucuje kes za ovu definiciju.
+ */
+    esSmTranCache_T * smTranCache;
+
+/**
+ * @brief       Tabela hijerarhije stanja
+ * @details     Koristi se samo kada je opcija @ref OPT_SMP_STATE_TABLE
+ *              ukljucena. Kada tabela postoji automat ne koristi red stanja ni
+ *              kes putanja tranzicija. Vrednost NULL iskljucuje tabelu.
+ */
+    const PORT_C_ROM esSmStateTable_T * smStateTable;
+
+/**
+ * @brief       Tabela prelaza
+ * @details     Koristi se samo kada je @ref OPT_SMP_SM_TYPES jednako
+ *              @ref ES_SMP_FSM_TABLE i tada zamenjuje clanove @c smInitState i
+ *              @c smLevels.
+ */
+    const PORT_C_ROM esSmTable_T * smTable;
 } esSmDef_T;
 
 /**
  * @brief       Struktura automata
+ * @details     Struktura sadrzi trenutno stanje automata. Ostali clanovi su
+ *              opcioni. Ukoliko se koriste HSM automati koriste se pokazivaci
+ *              na redove cekanja za stanja automata.
+ * @notapi
  */
-typedef struct esSm {
+struct esSm {
 
-#if (OPT_MM_DISTRIBUTION != ES_MM_DYNAMIC_ONLY)                                 \
-    && (OPT_MM_DISTRIBUTION != ES_MM_STATIC_ONLY)                               \
-    || defined(__DOXYGEN__)
+#if (OPT_LOG_LEVEL <= LOG_DBG) || defined(__DOXYGEN__)
 /**
- * @brief       Pokazivac na klasu memorijskog alokatora
+ * @brief       Potpis koji pokazuje da je ovo zaista SM objekat.
  */
-    const PORT_C_ROM struct memClass * memClass;
+    uint16_t        signature;
 #endif
 
 /**
@@ -214,7 +597,47 @@ typedef struct esSm {
     esStatus_T (* dispatch)(struct esSm *, const esEvt_T *);
 #endif
 
-#if (OPT_SMP_SM_TYPES != ES_SMP_FSM_ONLY) || defined(__DOXYGEN__)
+#if (1U == OPT_SMP_TRAN_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief       Kes putanja tranzicija iz definicione strukture automata
+ * @details     Vrednost NULL znaci da automat ne koristi kes.
+ */
+    esSmTranCache_T * tranCache;
+#endif
+
+#if (1U == OPT_SMP_STATE_TABLE) || defined(__DOXYGEN__)
+/**
+ * @brief       Tabela hijerarhije stanja iz definicione strukture automata
+ * @details     Vrednost NULL znaci da se hijerarhija otkriva SIG_SUPER
+ *              signalom.
+ */
+    const PORT_C_ROM esSmStateTable_T * stateTable;
+#endif
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE) || defined(__DOXYGEN__)
+/**
+ * @brief       Tabela prelaza iz definicione strukture automata
+ */
+    const PORT_C_ROM esSmTable_T * table;
+#endif
+
+#if (1U == OPT_SMP_STATE_TABLE) || (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)      \
+    || defined(__DOXYGEN__)
+/**
+ * @brief       Indeks trenutnog stanja u tabeli hijerarhije ili tabeli prelaza
+ */
+    uint8_t         stateIdx;
+#endif
+
+#if (1U == OPT_SMP_STATE_MASK) || defined(__DOXYGEN__)
+/**
+ * @brief       Broj poziva funkcija stanja koje je dispecer preskocio
+ */
+    uint32_t        skipped;
+#endif
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_HSM_ONLY)                                      \
+    || (OPT_SMP_SM_TYPES == ES_SMP_FSM_AND_HSM) || defined(__DOXYGEN__)
 /**
  * @brief       Niz za cuvanje izvornih stanja HSM automata
  * @details     Ovaj clan se koristi samo ukoliko se koriste HSM automati.
@@ -222,10 +645,14 @@ typedef struct esSm {
     esState_T *     stateQBegin;
 
 /**
- * @brief       Signalni događaji koji se koriste prilikom izvršavanja automata
- * @details     Identifikatori događaja su navedeni u @ref esEvtSignalId
+ * @brief       Niz za cuvanje odredisnih stanja HSM automata
+ * @details     Ovaj clan se koristi samo ukoliko se koriste HSM automati.
  */
-extern const C_ROM esEvt_T esEvtSignal[];
+    esState_T *     stateQEnd;
+#endif
+};
+
+/*======================================================  GLOBAL VARIABLES  ==*/
 
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
@@ -282,6 +709,114 @@ esStatus_T esSmDispatch(
     esSm_T *        sm,
     const esEvt_T * evt);
 
+/**
+ * @brief       Dobavlja statistiku kesa putanja tranzicija
+ * @param       [in] cache              Pokazivac na kes,
+ * @param       [out] status            struktura u koju se upisuje statistika.
+ * @details     Odnos @c hit i @c miss pokazuje koliko SIG_SUPER pretraga
+ *              hijerarhije je kes ustedeo.
+ * @api
+ */
+void esSmTranCacheStatusGet(
+    const esSmTranCache_T * cache,
+    esSmTranCacheStatus_T * status);
+
+/**
+ * @brief       Vraca broj poziva funkcija stanja koje je dispecer preskocio
+ * @param       [in] sm                 Pokazivac na automat.
+ * @return      Broj funkcija stanja koje nisu pozvane jer prema maski ne
+ *              obradjuju dogadjaj, od kreiranja automata.
+ * @details     Za EPA objekat se predaje pokazivac na EPA objekat konvertovan
+ *              u pokazivac na automat.
+ * @note        Koristi se samo kada je opcija @ref OPT_SMP_STATE_MASK
+ *              ukljucena.
+ * @api
+ */
+uint32_t esSmSkippedGet(
+    const esSm_T *  sm);
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Skup FSM automata zadatih tabelom prelaza
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Inicijalizuje skup automata
+ * @param       [out] pool              Pokazivac na skup automata,
+ * @param       [in] table              tabela prelaza svih automata,
+ * @param       [in] state              niz od @c size bajtova za stanja,
+ * @param       [in] data               niz od <code>size * dataSize</code>
+ *                                      bajtova za korisnicke podatke ili NULL
+ *                                      kada je @c dataSize jednako 0,
+ * @param       dataSize                velicina korisnickih podataka jednog
+ *                                      automata,
+ * @param       size                    broj automata.
+ * @details     Svi automati se postavljaju u inicijalno stanje tabele.
+ *              Korisnicki podaci se ne menjaju.
+ * @api
+ */
+void esSmPoolInit(
+    esSmPool_T *    pool,
+    const PORT_C_ROM esSmTable_T * table,
+    uint8_t *       state,
+    void *          data,
+    size_t          dataSize,
+    uint32_t        size);
+
+/**
+ * @brief       Salje jedan dogadjaj grupi automata iz skupa
+ * @param       [in] pool               Pokazivac na skup automata,
+ * @param       [in] indices            niz indeksa automata kojima se salje
+ *                                      dogadjaj ili NULL za automate sa
+ *                                      indeksima od 0 do <code>count - 1</code>,
+ * @param       count                   broj automata kojima se salje dogadjaj,
+ * @param       [in] evt                dogadjaj.
+ * @return      Broj automata koji su obradili dogadjaj.
+ * @details     Kolona tabele za dati dogadjaj se odredjuje jednom, a zatim se
+ *              za svaki automat cita jedan bajt stanja i jedna celija tabele.
+ *              Akcija dobija pokazivac na korisnicke podatke automata. Indeksi
+ *              sortirani u rastucem redosledu daju sekvencijalan pristup
+ *              memoriji.
+ * @note        Funkcija nije reentrant za isti skup automata.
+ * @api
+ */
+uint32_t esSmPoolDispatch(
+    esSmPool_T *    pool,
+    const uint32_t * indices,
+    uint32_t        count,
+    const esEvt_T * evt);
+
+/**
+ * @brief       Vraca stanje automata iz skupa
+ * @param       [in] pool               Pokazivac na skup automata,
+ * @param       idx                     indeks automata.
+ * @return      Indeks stanja u tabeli prelaza.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS uint_fast8_t esSmPoolStateGet(
+    const esSmPool_T * pool,
+    uint32_t        idx) {
+
+    return (pool->state[idx]);
+}
+
+/**
+ * @brief       Vraca pokazivac na korisnicke podatke automata iz skupa
+ * @param       [in] pool               Pokazivac na skup automata,
+ * @param       idx                     indeks automata.
+ * @return      Pokazivac na korisnicke podatke.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void * esSmPoolDataGet(
+    const esSmPool_T * pool,
+    uint32_t        idx) {
+
+    return ((void *)&pool->data[(size_t)idx * pool->dataSize]);
+}
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Najvisi nivo hijerarhije
+ * @{ *//*--------------------------------------------------------------------*/
+
 /**
  * @brief       Najvisi nivo u hijerarhiji HSM automata.
  * @param       [in] sm                 Pokazivac na strukturu HSM automata,
@@ -0,0 +1,216 @@
+/******************************************************************************
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interfejs Time Event Management (TEM) modula
+ * @details     This file is not meant to be included in application code
+ *              independently but through the inclusion of "kernel.h" file.
+ * @addtogroup  tem_intf
+ *********************************************************************//** @{ */
+
+#ifndef TEM_H_
+#define TEM_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include "eds/core.h"
+
+/*===============================================================  DEFINES  ==*/
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Tip brojaca sistemskih tikova
+ * @details     Brojac se prekoracuje, pa se vremena uvek porede preko razlike.
+ *              Najvece kasnjenje vremenskog dogadjaja je zato polovina opsega
+ *              ovog tipa.
+ * @api
+ */
+typedef uint32_t esTick_T;
+
+/**@brief       Vremenski dogadjaj
+ * @details     Vremenski dogadjaj salje dogadjaj @ref evt EPA objektu @ref epa
+ *              kada istekne zadato vreme. Jednokratni vremenski dogadjaj se
+ *              nakon isteka razoruzava, a periodicni se ponovo naoruzava sa
+ *              periodom @ref period.
+ *
+ *              Dok je naoruzan, vremenski dogadjaj se nalazi u jednoj lokaciji
+ *              hijerarhijskog tocka. Struktura se ne sme menjati direktno.
+ * @api
+ */
+typedef struct esTimeEvt {
+/**@brief       Clan liste lokacije tocka
+ * @details     Kada vremenski dogadjaj nije naoruzan clan pokazuje sam na sebe.
+ */
+    esDlsList_T     list;
+
+/**@brief       Apsolutni trenutak isteka, u sistemskim tikovima
+ */
+    esTick_T        expire;
+
+/**@brief       Perioda ponavljanja, 0 za jednokratni vremenski dogadjaj
+ */
+    esTick_T        period;
+
+/**@brief       EPA objekat kome se salje dogadjaj
+ */
+    esEpa_T *       epa;
+
+/**@brief       Dogadjaj koji se salje nakon isteka vremena
+ */
+    esEvt_T *       evt;
+
+#if defined(OPT_KERN_API_VALIDATION) || defined(__DOXYGEN__)
+/**@brief       Potpis koji pokazuje da je ovo zaista vremenski dogadjaj.
+ */
+    uint32_t        signature;
+#endif
+} esTimeEvt_T;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/*------------------------------------------------------------------------*//**
+ * @name        Vremenski dogadjaji
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Inicijalizuje vremenski dogadjaj
+ * @param       timeEvt
+ *              Pokazivac na vremenski dogadjaj.
+ * @param       epa
+ *              EPA objekat kome se salje dogadjaj.
+ * @param       evt
+ *              Dogadjaj koji se salje. Posto se isti dogadjaj salje pri svakom
+ *              isteku, dinamicki dogadjaj se oznacava kao rezervisan funkcijom
+ *              esEvtReserve() i nikada se ne unistava nakon obrade.
+ * @api
+ */
+void esTimeEvtInit(
+    esTimeEvt_T *   timeEvt,
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+/**@brief       Naoruzava vremenski dogadjaj
+ * @param       timeEvt
+ *              Pokazivac na vremenski dogadjaj.
+ * @param       delay
+ *              Broj sistemskih tikova do prvog isteka, mora biti veci od 0.
+ * @param       period
+ *              Perioda ponavljanja u sistemskim tikovima, 0 za jednokratni
+ *              vremenski dogadjaj.
+ * @details     Vremenski dogadjaj koji je vec naoruzan se prvo razoruzava.
+ *              Vreme izvrsenja ne zavisi od broja naoruzanih vremenskih
+ *              dogadjaja.
+ * @api
+ */
+void esTimeEvtArm(
+    esTimeEvt_T *   timeEvt,
+    esTick_T        delay,
+    esTick_T        period);
+
+/**@brief       Naoruzava vremenski dogadjaj
+ * @see         esTimeEvtArm()
+ * @iclass
+ */
+void esTimeEvtArmI(
+    esTimeEvt_T *   timeEvt,
+    esTick_T        delay,
+    esTick_T        period);
+
+/**@brief       Razoruzava vremenski dogadjaj
+ * @param       timeEvt
+ *              Pokazivac na vremenski dogadjaj.
+ * @return      Da li je vremenski dogadjaj bio naoruzan.
+ *  @retval     TRUE - vremenski dogadjaj je razoruzan pre isteka,
+ *  @retval     FALSE - vremenski dogadjaj nije bio naoruzan.
+ * @api
+ */
+bool_T esTimeEvtDisarm(
+    esTimeEvt_T *   timeEvt);
+
+/**@brief       Razoruzava vremenski dogadjaj
+ * @see         esTimeEvtDisarm()
+ * @iclass
+ */
+bool_T esTimeEvtDisarmI(
+    esTimeEvt_T *   timeEvt);
+
+/**@brief       Ispituje da li je vremenski dogadjaj naoruzan
+ * @param       timeEvt
+ *              Pokazivac na vremenski dogadjaj.
+ * @api
+ */
+bool_T esTimeEvtIsArmed(
+    const esTimeEvt_T * timeEvt);
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Sistemski tik
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Obradjuje jedan sistemski tik
+ * @details     Poziva je prekidna rutina sistemskog tajmera porta. Funkcija
+ *              pomera tocak za jednu lokaciju i salje dogadjaje svih vremenskih
+ *              dogadjaja kojima je isteklo vreme.
+ * @iclass
+ */
+void esTemTickI(
+    void);
+
+/**@brief       Obradjuje vise sistemskih tikova odjednom
+ * @param       ticks
+ *              Broj tikova koji su protekli od poslednje obrade.
+ * @details     Poziva je port koji zaustavlja periodicne tikove, kada se
+ *              tajmer javi nakon zaustavljanja. Ukoliko su tikovi i dalje
+ *              zaustavljeni, tajmer se ponovo programira za sledeci istek ili
+ *              razvrstavanje, jer razvrstavanje visih nivoa tocka ne salje
+ *              dogadjaje i ne budi ni jedno jezgro koje bi to uradilo.
+ *
+ *              Brojac tikova se pomera odjednom preko praznih lokacija, pa
+ *              cena zavisi od broja punih lokacija koje dolaze na red, a ne od
+ *              duzine perioda u kome su tikovi bili zaustavljeni.
+ * @iclass
+ */
+void esTemTickNI(
+    esTick_T        ticks);
+
+/**@brief       Vraca trenutnu vrednost brojaca sistemskih tikova
+ * @api
+ */
+esTick_T esTemTickGet(
+    void);
+
+/** @} *//*-----------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of tem.h
+ ******************************************************************************/
+#endif /* TEM_H_ */
@@ -0,0 +1,225 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interfejs TLSF dinamickog alokatora
+ * @details     Two-Level Segregated Fit alokator zauzima i oslobadja memoriju
+ *              u konstantnom vremenu. Slobodni blokovi su razvrstani u liste po
+ *              velicini: prvi nivo je stepen dvojke velicine, a drugi nivo
+ *              deli svaki stepen dvojke na @ref ES_TLSF_SL_COUNT jednakih
+ *              opsega. Bit mape oba nivoa omogucavaju da se odgovarajuca lista
+ *              pronadje sa dve find-first-set operacije. Susedni slobodni
+ *              blokovi se odmah spajaju.
+ * @addtogroup  tlsf_intf
+ *********************************************************************//** @{ */
+
+#ifndef TLSF_H_
+#define TLSF_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arch/compiler.h"
+#include "arch/cpu.h"
+
+/*===============================================================  DEFINES  ==*/
+
+/**@brief       Logaritam broja lista drugog nivoa
+ */
+#define ES_TLSF_SL_LOG2                 4U
+
+/**@brief       Broj lista drugog nivoa za jedan stepen dvojke
+ */
+#define ES_TLSF_SL_COUNT                (1U << ES_TLSF_SL_LOG2)
+
+/**@brief       Logaritam poravnanja velicine blokova
+ */
+#define ES_TLSF_ALIGN_LOG2              ((8U == sizeof(size_t)) ? 3U : 2U)
+
+/**@brief       Logaritam najmanjeg bloka koji se razvrstava po stepenu dvojke
+ * @details     Blokovi manji od <code>2^ES_TLSF_FL_SHIFT</code> se nalaze u
+ *              prvom redu matrice i razvrstavaju se linearno.
+ */
+#define ES_TLSF_FL_SHIFT                (ES_TLSF_SL_LOG2 + ES_TLSF_ALIGN_LOG2)
+
+/**@brief       Broj lista prvog nivoa
+ */
+#define ES_TLSF_FL_COUNT                (OPT_MEM_TLSF_FL_MAX - ES_TLSF_FL_SHIFT + 1U)
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Zaglavlje memorijskog bloka TLSF alokatora
+ * @details     Zaglavlje zauzetog bloka cine samo @c prevPhys i @c size.
+ *              Slobodan blok u svom korisnom prostoru cuva i veze liste
+ *              slobodnih blokova.
+ */
+struct esTlsfBlock {
+    struct esTlsfBlock * prevPhys;                                              /**< @brief Prethodni blok u memoriji                       */
+    size_t              size;                                                   /**< @brief Velicina korisnog prostora i bit zauzetosti     */
+    struct esTlsfBlock * nextFree;                                              /**< @brief Sledeci slobodan blok iste klase                */
+    struct esTlsfBlock * prevFree;                                              /**< @brief Prethodni slobodan blok iste klase              */
+};
+
+/**@brief       Deskriptor TLSF alokatora
+ * @api
+ */
+typedef struct esTlsf {
+    uint32_t            flBitmap;                                               /**< @brief Neprazne liste prvog nivoa                      */
+    uint32_t            slBitmap[ES_TLSF_FL_COUNT];                             /**< @brief Neprazne liste drugog nivoa                     */
+    struct esTlsfBlock * free[ES_TLSF_FL_COUNT][ES_TLSF_SL_COUNT];              /**< @brief Liste slobodnih blokova                         */
+    size_t              size;                                                   /**< @brief Ukupan korisni prostor nakon inicijalizacije    */
+    size_t              freeSize;                                               /**< @brief Zbir korisnog prostora slobodnih blokova        */
+    uint32_t            freeBlocks;                                             /**< @brief Broj slobodnih blokova                          */
+} esTlsf_T;
+
+/**@brief       Statistika TLSF alokatora
+ * @api
+ */
+typedef struct esTlsfStatus {
+    size_t              size;                                                   /**< @brief Ukupan korisni prostor                          */
+    size_t              freeSize;                                               /**< @brief Slobodan prostor                                */
+    size_t              freeMax;                                                /**< @brief Najveci slobodan blok                           */
+    uint32_t            freeBlocks;                                             /**< @brief Broj slobodnih blokova                          */
+    uint_fast16_t       fragmentation;                                          /**< @brief Fragmentacija u promilima                       */
+} esTlsfStatus_T;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+
+/**@brief       Podrazumevani TLSF alokator
+ * @details     Koristi se kao @ref OPT_MEM_DYN_HANDLE kada je ukljucena opcija
+ *              @ref OPT_MEM_DYN_TLSF. Aplikacija ga mora inicijalizovati
+ *              funkcijom esTlsfInit() pre inicijalizacije kernela.
+ * @api
+ */
+extern esTlsf_T DefTlsfHandle;
+
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/*------------------------------------------------------------------------*//**
+ * @name        TLSF alokator
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Inicijalizuje TLSF alokator
+ * @param       tlsf
+ *              Pokazivac na deskriptor alokatora.
+ * @param       storage
+ *              Memorijska oblast kojom alokator upravlja.
+ * @param       storageSize
+ *              Velicina memorijske oblasti u bajtovima.
+ * @details     Prostor veci od <code>2^OPT_MEM_TLSF_FL_MAX</code> bajtova se ne
+ *              koristi.
+ * @api
+ */
+void esTlsfInit(
+    esTlsf_T *          tlsf,
+    void *              storage,
+    size_t              storageSize);
+
+/**@brief       Zauzima memorijski blok
+ * @param       tlsf
+ *              Pokazivac na deskriptor alokatora.
+ * @param       size
+ *              Potrebna velicina u bajtovima.
+ * @return      Pokazivac na blok ili NULL ako nema dovoljno velikog slobodnog
+ *              bloka.
+ * @details     Vreme izvrsenja ne zavisi od broja ni velicine zauzetih blokova.
+ * @iclass
+ */
+void * esTlsfAllocI(
+    esTlsf_T *          tlsf,
+    size_t              size);
+
+/**@brief       Zauzima memorijski blok
+ * @param       tlsf
+ *              Pokazivac na deskriptor alokatora.
+ * @param       size
+ *              Potrebna velicina u bajtovima.
+ * @return      Pokazivac na blok ili NULL ako nema dovoljno velikog slobodnog
+ *              bloka.
+ * @api
+ */
+void * esTlsfAlloc(
+    esTlsf_T *          tlsf,
+    size_t              size);
+
+/**@brief       Oslobadja memorijski blok
+ * @param       tlsf
+ *              Pokazivac na deskriptor alokatora.
+ * @param       mem
+ *              Blok koji je zauzet sa esTlsfAllocI() ili esTlsfAlloc().
+ * @details     Blok se odmah spaja sa susednim slobodnim blokovima.
+ * @iclass
+ */
+void esTlsfDeAllocI(
+    esTlsf_T *          tlsf,
+    void *              mem);
+
+/**@brief       Oslobadja memorijski blok
+ * @param       tlsf
+ *              Pokazivac na deskriptor alokatora.
+ * @param       mem
+ *              Blok koji je zauzet sa esTlsfAllocI() ili esTlsfAlloc().
+ * @api
+ */
+void esTlsfDeAlloc(
+    esTlsf_T *          tlsf,
+    void *              mem);
+
+/**@brief       Dobavlja statistiku alokatora
+ * @param       tlsf
+ *              Pokazivac na deskriptor alokatora.
+ * @param       [out] status
+ *              Struktura u koju se upisuje statistika.
+ * @details     Fragmentacija je deo slobodnog prostora koji se ne moze zauzeti
+ *              jednim zahtevom: <code>1000 * (1 - freeMax / freeSize)</code>.
+ *              Vreme izvrsenja zavisi od broja blokova u listi najvece klase.
+ * @api
+ */
+void esTlsfStatusGet(
+    esTlsf_T *          tlsf,
+    esTlsfStatus_T *    status);
+
+/** @} *//*-----------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (31U < OPT_MEM_TLSF_FL_MAX) || (12U > OPT_MEM_TLSF_FL_MAX)
+# error "eSolid: TLSF: Option OPT_MEM_TLSF_FL_MAX must be between 12 and 31."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of tlsf.h
+ ******************************************************************************/
+#endif /* TLSF_H_ */
@@ -0,0 +1,264 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interfejs lock-free pool alokatora.
+ * @details     Slobodni blokovi su povezani u Treiber stek. Vrh steka je jedna
+ *              64-bitna atomska rec koja sadrzi indeks prvog slobodnog bloka i
+ *              oznaku (tag) koja se povecava pri svakoj promeni vrha. Zbog
+ *              oznake compare-and-swap ne uspeva ukoliko je izmedju citanja i
+ *              upisa vrha neka druga nit uzela i vratila isti blok (ABA
+ *              problem).
+ *
+ *              Indeks sledeceg slobodnog bloka se cuva u prvoj reci samog
+ *              bloka, pa alokator ne zahteva dodatnu memoriju. Nit koja je
+ *              procitala zastarelu vezu to uvek otkrije kroz neuspesan
+ *              compare-and-swap, jer memorija bloka nikada ne napusta pool.
+ * @addtogroup  lfpool_intf
+ *********************************************************************//** @{ */
+
+#ifndef LFPOOL_H_
+#define LFPOOL_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdatomic.h>
+
+#include "arch/compiler.h"
+#include "arch/cpu.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**
+ * @brief       Broj bita vrha steka koji cuvaju indeks bloka
+ */
+#define ES_LFPOOL_IDX_BITS              32U
+
+/**
+ * @brief       Maska indeksa bloka u vrhu steka
+ */
+#define ES_LFPOOL_IDX_MASK                                                      \
+    (((uint_least64_t)1U << ES_LFPOOL_IDX_BITS) - 1U)
+
+/**
+ * @brief       Vrednost za oznaku (tag) koja se dodaje pri svakoj promeni vrha
+ */
+#define ES_LFPOOL_TAG_INC                                                       \
+    ((uint_least64_t)1U << ES_LFPOOL_IDX_BITS)
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**
+ * @brief       Struktura zaglavlja lock-free pool alokatora
+ * @details     Indeksi blokova u vrhu steka i u vezama su uvecani za jedan,
+ *              tako da nula oznacava kraj liste slobodnih blokova.
+ */
+typedef struct esLfPool {
+/**
+ * @brief       Vrh steka: oznaka (gornja rec) i indeks bloka (donja rec)
+ */
+    atomic_uint_least64_t head;
+
+/**
+ * @brief       Pocetak memorijske oblasti pool-a
+ */
+    uint8_t *       storage;
+
+/**
+ * @brief       Velicina jednog bloka, poravnata na PORT_DATA_ALIGNMENT
+ */
+    size_t          blockSize;
+
+/**
+ * @brief       Ukupan broj blokova u pool-u
+ */
+    uint_least32_t  nBlocks;
+} esLfPool_T;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/*------------------------------------------------------------------------*//**
+ * @name        Manipulacija sa lock-free pool alokatorom
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Vrsi inicijalizaciju lock-free pool alokatora
+ * @param       pool                    Pokazivac na pool koji se inicijalizuje,
+ * @param       storage                 memorijska oblast za blokove,
+ * @param       storageSize             velicina memorijske oblasti u bajtovima,
+ * @param       blockSize               velicina jednog bloka u bajtovima.
+ * @details     Velicina bloka se zaokruzuje na umnozak PORT_DATA_ALIGNMENT.
+ *              Ne sme se pozvati dok drugi kontekst koristi pool.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esLfPoolInit_(
+    esLfPool_T *    pool,
+    void *          storage,
+    size_t          storageSize,
+    size_t          blockSize) {
+
+    uint_least32_t  cnt;
+
+    if (sizeof(atomic_uint_least32_t) > blockSize) {
+        blockSize = sizeof(atomic_uint_least32_t);
+    }
+    blockSize = (blockSize + (PORT_DATA_ALIGNMENT - 1U)) & ~(size_t)(PORT_DATA_ALIGNMENT - 1U);
+    pool->storage = (uint8_t *)storage;
+    pool->blockSize = blockSize;
+    pool->nBlocks = (uint_least32_t)(storageSize / blockSize);
+    cnt = 0U;
+
+    while (cnt < pool->nBlocks) {
+        uint_least32_t next;
+
+        next = cnt + 2U;                                                        /* Veza na sledeci blok, indeks uvecan za jedan.            */
+
+        if (next > pool->nBlocks) {
+            next = 0U;
+        }
+        atomic_init(
+            (atomic_uint_least32_t *)&pool->storage[cnt * blockSize],
+            next);
+        cnt++;
+    }
+
+    if (0U != pool->nBlocks) {
+        atomic_init(&pool->head, 1U);
+    } else {
+        atomic_init(&pool->head, 0U);
+    }
+}
+
+/**
+ * @brief       Dobavlja memorijski blok iz pool-a
+ * @param       pool                    Pokazivac na pool.
+ * @return      Pokazivac na blok ili NULL ukoliko je pool prazan.
+ * @details     Moze se pozvati iz bilo kog konteksta i sa bilo kog jezgra, bez
+ *              kriticne sekcije.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void * esLfPoolAlloc_(
+    esLfPool_T *    pool) {
+
+    uint_least64_t  head;
+    uint8_t *       block;
+    bool_T          isPending;
+
+    block = NULL;
+    isPending = TRUE;
+    head = atomic_load_explicit(
+        &pool->head,
+        memory_order_acquire);
+
+    while (TRUE == isPending) {
+        uint_least32_t  idx;
+        uint_least64_t  newHead;
+
+        idx = (uint_least32_t)(head & ES_LFPOOL_IDX_MASK);
+
+        if (0U == idx) {                                                        /* Pool je prazan.                                          */
+            block = NULL;
+            isPending = FALSE;
+        } else {
+            block = &pool->storage[(size_t)(idx - 1U) * pool->blockSize];
+            newHead = (head & ~ES_LFPOOL_IDX_MASK) + ES_LFPOOL_TAG_INC;
+            newHead |= atomic_load_explicit(
+                (atomic_uint_least32_t *)block,
+                memory_order_relaxed);                                          /* Veza moze biti zastarela, CAS ce to otkriti.             */
+
+            if (atomic_compare_exchange_weak_explicit(&pool->head, &head, newHead,
+                    memory_order_acquire, memory_order_acquire)) {
+                isPending = FALSE;
+            }
+        }
+    }
+
+    return ((void *)block);
+}
+
+/**
+ * @brief       Vraca memorijski blok u pool
+ * @param       pool                    Pokazivac na pool,
+ * @param       mem                     blok koji je dobavljen sa
+ *                                      esLfPoolAlloc_().
+ * @details     Moze se pozvati iz bilo kog konteksta i sa bilo kog jezgra, bez
+ *              kriticne sekcije.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esLfPoolDeAlloc_(
+    esLfPool_T *    pool,
+    void *          mem) {
+
+    uint_least64_t  head;
+    uint_least64_t  newHead;
+    uint_least32_t  idx;
+
+    idx = (uint_least32_t)(((uint8_t *)mem - pool->storage) / pool->blockSize) + 1U;
+    head = atomic_load_explicit(
+        &pool->head,
+        memory_order_relaxed);
+
+    do {
+        atomic_store_explicit(
+            (atomic_uint_least32_t *)mem,
+            (uint_least32_t)(head & ES_LFPOOL_IDX_MASK),
+            memory_order_relaxed);
+        newHead = ((head & ~ES_LFPOOL_IDX_MASK) + ES_LFPOOL_TAG_INC) | idx;
+    } while (!atomic_compare_exchange_weak_explicit(&pool->head, &head, newHead,
+        memory_order_release, memory_order_relaxed));
+}
+
+/**
+ * @brief       Vraca velicinu bloka pool-a
+ * @param       pool                    Pokazivac na pool.
+ * @return      Velicina bloka u bajtovima.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS size_t esLfPoolBlockSize_(
+    const esLfPool_T * pool) {
+
+    return (pool->blockSize);
+}
+
+/** @} *//*-----------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (2 != ATOMIC_LLONG_LOCK_FREE)
+# error "eSolid: LFPOOL: lock-free pool requires lock-free 64-bit atomic operations."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of lfpool.h
+ ******************************************************************************/
+#endif /* LFPOOL_H_ */
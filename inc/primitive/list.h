@@ -34,7 +34,7 @@
 #define LIST_H_
 
 /*=========================================================  INCLUDE FILES  ==*/
-#include "hal/hal.h"
+#include "arch/compiler.h"
 
 /*===============================================================  DEFINES  ==*/
 /*===============================================================  MACRO's  ==*/
@@ -204,7 +204,7 @@ typedef struct esDlsList {
  * @details     Vrsi inicijalizaciju clana da pokazuje na samog sebe.
  * @inline
  */
-static C_INLINE_ALWAYS void esSlsNodeInit_(
+static PORT_C_INLINE_ALWAYS void esSlsNodeInit_(
     esSlsList_T *   node) {
 
     node->next = node;
@@ -216,7 +216,7 @@ static C_INLINE_ALWAYS void esSlsNodeInit_(
  * @details     Cuvar liste se mora inicijalizovati pre koriscenja liste.
  * @inline
  */
-static C_INLINE_ALWAYS void esSlsSentinelInit_(
+static PORT_C_INLINE_ALWAYS void esSlsSentinelInit_(
     esSlsList_T *   sentinel) {
 
     esSlsNodeInit_(
@@ -234,7 +234,7 @@ static C_INLINE_ALWAYS void esSlsSentinelInit_(
  *              inicijalizovan funkcijom esSlsNodeInit_().
  * @inline
  */
-static C_INLINE_ALWAYS void esSlsNodeAdd_(
+static PORT_C_INLINE_ALWAYS void esSlsNodeAdd_(
     esSlsList_T *   newNode,
     esSlsList_T *   prevNode,
     esSlsList_T *   nextNode) {
@@ -249,7 +249,7 @@ static C_INLINE_ALWAYS void esSlsNodeAdd_(
  * @param       newNode                 pokazivac na clan koji se dodaje.
  * @inline
  */
-static C_INLINE_ALWAYS void esSlsNodeAddAfter_(
+static PORT_C_INLINE_ALWAYS void esSlsNodeAddAfter_(
     esSlsList_T *   currNode,
     esSlsList_T *   newNode) {
 
@@ -265,7 +265,7 @@ static C_INLINE_ALWAYS void esSlsNodeAddAfter_(
  * @param       newNode                 pokazivac na clan koji se dodaje.
  * @inline
  */
-static C_INLINE_ALWAYS void esSlsNodeAddHead_(
+static PORT_C_INLINE_ALWAYS void esSlsNodeAddHead_(
     esSlsList_T *   sentinel,
     esSlsList_T *   newNode) {
 
@@ -285,7 +285,7 @@ static C_INLINE_ALWAYS void esSlsNodeAddHead_(
  *              sledeci clanovi liste.
  * @inline
  */
-static C_INLINE_ALWAYS void esSlsNodeRm_(
+static PORT_C_INLINE_ALWAYS void esSlsNodeRm_(
     esSlsList_T *   oldNode,
     esSlsList_T *   prevNode,
     esSlsList_T *   nextNode) {
@@ -300,7 +300,7 @@ static C_INLINE_ALWAYS void esSlsNodeRm_(
  *                                      kojeg treba ukloniti clan
  * @inline
  */
-static C_INLINE_ALWAYS void esSlsNodeRmAfter_(
+static PORT_C_INLINE_ALWAYS void esSlsNodeRmAfter_(
     esSlsList_T *   currNode) {
 
     esSlsNodeRm_(
@@ -319,7 +319,7 @@ static C_INLINE_ALWAYS void esSlsNodeRmAfter_(
  * @param       node                    Pokazivac na clan DLS liste.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsNodeInit_(
+static PORT_C_INLINE_ALWAYS void esDlsNodeInit_(
     esDlsList_T *   node) {
 
     node->next = node;
@@ -332,7 +332,7 @@ static C_INLINE_ALWAYS void esDlsNodeInit_(
  *                                      u strukturi podataka.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsSentinelInit_(
+static PORT_C_INLINE_ALWAYS void esDlsSentinelInit_(
     esDlsList_T *   sentinel) {
 
     esDlsNodeInit_(
@@ -349,7 +349,7 @@ static C_INLINE_ALWAYS void esDlsSentinelInit_(
  *              clanovi.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsNodeAdd_(
+static PORT_C_INLINE_ALWAYS void esDlsNodeAdd_(
     esDlsList_T *   newNode,
     esDlsList_T *   prevNode,
     esDlsList_T *   nextNode) {
@@ -366,7 +366,7 @@ static C_INLINE_ALWAYS void esDlsNodeAdd_(
  * @param       newNode                 pokazivac na clan koji se dodaje.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsNodeAddHead_(
+static PORT_C_INLINE_ALWAYS void esDlsNodeAddHead_(
     esDlsList_T *   sentinel,
     esDlsList_T *   newNode) {
 
@@ -382,7 +382,7 @@ static C_INLINE_ALWAYS void esDlsNodeAddHead_(
  * @param       newNode                 pokazivac na clan koji se dodaje.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsNodeAddTail_(
+static PORT_C_INLINE_ALWAYS void esDlsNodeAddTail_(
     esDlsList_T *   sentinel,
     esDlsList_T *   newNode) {
 
@@ -398,7 +398,7 @@ static C_INLINE_ALWAYS void esDlsNodeAddTail_(
  * @param       newNode                 pokazivac na clan koji se dodaje.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsNodeAddBefore_(
+static PORT_C_INLINE_ALWAYS void esDlsNodeAddBefore_(
     esDlsList_T *   currNode,
     esDlsList_T *   newNode) {
 
@@ -414,7 +414,7 @@ static C_INLINE_ALWAYS void esDlsNodeAddBefore_(
  * @param       newNode                 pokazivac na clan koji se dodaje.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsNodeAddAfter_(
+static PORT_C_INLINE_ALWAYS void esDlsNodeAddAfter_(
     esDlsList_T *   currNode,
     esDlsList_T *   newNode) {
 
@@ -429,7 +429,7 @@ static C_INLINE_ALWAYS void esDlsNodeAddAfter_(
  * @param       oldNode                 Pokazivac na clan koji se uklanja.
  * @inline
  */
-static C_INLINE_ALWAYS void esDlsNodeRm_(
+static PORT_C_INLINE_ALWAYS void esDlsNodeRm_(
     esDlsList_T *   oldNode) {
 
     oldNode->next->prev = oldNode->prev;
@@ -444,7 +444,7 @@ static C_INLINE_ALWAYS void esDlsNodeRm_(
  *  @retval     FALSE - lista nije prazna
  * @inline
  */
-static C_INLINE_ALWAYS bool_T esDlsIsEmpty_(
+static PORT_C_INLINE_ALWAYS bool_T esDlsIsEmpty_(
     esDlsList_T *   sentinel) {
 
     if (sentinel->next != sentinel) {
@@ -94,6 +94,58 @@ typedef struct esQueue {
     uint8_t *       end;
 } esQ_T;
 
+/**
+ * @brief       Struktura zaglavlja indirektnog reda za cekanje cija je velicina
+ *              stepen dvojke
+ */
+typedef struct esQueuePtrPow2 {
+/**
+ * @brief       Bafer reda za cekanje
+ */
+    void **         buff;
+
+/**
+ * @brief       Indeks pocetka reda za cekanje, samo se povecava
+ */
+    size_t          head;
+
+/**
+ * @brief       Indeks kraja reda za cekanje, samo se povecava
+ */
+    size_t          tail;
+
+/**
+ * @brief       Maska indeksa, velicina reda - 1
+ */
+    size_t          mask;
+} esQpPow2_T;
+
+/**
+ * @brief       Struktura zaglavlja direktnog reda za cekanje cija je velicina
+ *              stepen dvojke
+ */
+typedef struct esQueuePow2 {
+/**
+ * @brief       Bafer reda za cekanje
+ */
+    uint8_t *       buff;
+
+/**
+ * @brief       Indeks pocetka reda za cekanje, samo se povecava
+ */
+    size_t          head;
+
+/**
+ * @brief       Indeks kraja reda za cekanje, samo se povecava
+ */
+    size_t          tail;
+
+/**
+ * @brief       Maska indeksa, velicina reda - 1
+ */
+    size_t          mask;
+} esQPow2_T;
+
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
@@ -299,6 +351,177 @@ static PORT_C_INLINE_ALWAYS bool_T esQpIsEmpty_(
     }
 }
 
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Manipilacija sa redovima cekanja sa pokazivacima velicine
+ *              stepena dvojke
+ * @details     Indeksi pocetka i kraja se samo povecavaju, a pozicija u
+ *              baferu se dobija maskiranjem. Provere da li je red pun ili
+ *              prazan i broj elemenata se svode na jedno oduzimanje, a upis i
+ *              citanje nemaju grananja. Za razliku od esQp_T reda, u red se
+ *              moze smestiti @c size elemenata.
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Vrsi inicijalizaciju strukture za red za cekanje
+ * @param       queue                   Pokazivac na tek kreirani red cekanja,
+ * @param       memBuff                 memorijska oblast koja se koristi,
+ * @param       size                    velicina potrebnog reda cekanja izrazena
+ *                                      u broju elemenata u redu za cekanje,
+ *                                      mora biti stepen dvojke.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esQpPow2Init_(
+    esQpPow2_T *    queue,
+    void **         memBuff,
+    size_t          size) {
+
+    queue->buff = memBuff;
+    queue->head = 0U;
+    queue->tail = 0U;
+    queue->mask = size - 1U;
+}
+
+/**
+ * @brief       Destruktor funkcija za red za cekanje
+ * @param       queue                   Red za cekanje koji treba da se unisti.
+ * @return      Pocetak bafera reda za cekanje.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void * esQpPow2DeInit_(
+    esQpPow2_T *    queue) {
+
+    void ** buff;
+
+    buff = queue->buff;
+    queue->buff = (void **)0U;
+    queue->head = 0U;
+    queue->tail = 0U;
+    queue->mask = 0U;
+
+    return ((void *)buff);
+}
+
+/**
+ * @brief       Postavlja element @b na @b kraju reda (tail) za cekanje (FIFO
+ *              metod)
+ * @param       queue                   Red cekanja gde treba postaviti dogadjaj,
+ * @param       item                    element koji treba postaviti u red za
+ *                                      cekanje.
+ * @pre         Red za cekanje je prethodno kreiran init funkcijom
+ *              esQpPow2Init_().
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esQpPow2Put_(
+    esQpPow2_T *    queue,
+    void *          item) {
+
+    queue->buff[queue->tail & queue->mask] = item;
+    ++queue->tail;
+}
+
+/**
+ * @brief       Postavlja dogadjaj @b na pocetku @b reda (head) za cekanje (LIFO
+ *              metod)
+ * @param       queue                   Red cekanja gde treba postaviti dogadjaj,
+ * @param       item                    element koji treba postaviti u red za
+ *                                      cekanje.
+ * @pre         Red za cekanje je prethodno kreiran init funkcijom
+ *              esQpPow2Init_().
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esQpPow2PutAhead_(
+    esQpPow2_T *    queue,
+    void *          item) {
+
+    --queue->head;
+    queue->buff[queue->head & queue->mask] = item;
+}
+
+/**
+ * @brief       Dobavlja element sa pocetka reda (head) za cekanje
+ * @param       queue                   Red za cekanje odakle treba dobaviti
+ *                                      element.
+ * @return      Element iz reda za cekanje.
+ * @pre         Red za cekanje je prethodno kreiran init funkcijom
+ *              esQpPow2Init_().
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void * esQpPow2Get_(
+    esQpPow2_T *    queue) {
+
+    void * tmp;
+
+    tmp = queue->buff[queue->head & queue->mask];
+    ++queue->head;
+
+    return (tmp);
+}
+
+/**
+ * @brief       Dobavlja koliko maksimalno elemenata moze da stane u red za
+ *              cekanje
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Maksimalan broj elemenata koji mogu da stanu u red za cekanje
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS size_t esQpPow2Size_(
+    const esQpPow2_T * queue) {
+
+    return (queue->mask + 1U);
+}
+
+/**
+ * @brief       Dobavlja velicinu reda za cekanje
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Trenutni broj elemenata u redu za cekanje.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS size_t esQpPow2Occupied_(
+    const esQpPow2_T * queue) {
+
+    return (queue->tail - queue->head);
+}
+
+/**
+ * @brief       Dobavlja koliko jos elemenata moze da se smesti u red za cekanje
+ * @param       queue                   Red za cekanje koji se ispituje
+ * @return      Koliko slobodnog prostora je preostalo.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS size_t esQpPow2FreeSpace_(
+    const esQpPow2_T * queue) {
+
+    return (queue->mask + 1U - (queue->tail - queue->head));
+}
+
+/**
+ * @brief       Vraca da li je red za cekanje pun
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Da li je red za cekanje pun?
+ *  @retval     TRUE - red za cekanje je pun
+ *  @retval     FALSE - red za cekanje nije pun
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS bool_T esQpPow2IsFull_(
+    const esQpPow2_T * queue) {
+
+    return ((bool_T)(queue->mask < (queue->tail - queue->head)));
+}
+
+/**
+ * @brief       Vraca da li je red za cekanje prazan
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Da li je red za cekanje prazan?
+ *  @retval     TRUE - red cekanja je prazan
+ *  @retval     FALSE - red cekanaj nije prazan
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS bool_T esQpPow2IsEmpty_(
+    const esQpPow2_T * queue) {
+
+    return ((bool_T)(queue->tail == queue->head));
+}
+
 /** @} *//*---------------------------------------------------------------*//**
  * @name        Manipilacija sa redovima cekanja sa podacima
  * @{ *//*--------------------------------------------------------------------*/
@@ -502,6 +725,177 @@ static PORT_C_INLINE_ALWAYS bool_T esQIsEmpty_(
     }
 }
 
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Manipilacija sa redovima cekanja sa podacima velicine
+ *              stepena dvojke
+ * @details     Indeksi pocetka i kraja se samo povecavaju, a pozicija u
+ *              baferu se dobija maskiranjem. Provere da li je red pun ili
+ *              prazan i broj elemenata se svode na jedno oduzimanje, a upis i
+ *              citanje nemaju grananja. Za razliku od esQ_T reda, u red se
+ *              moze smestiti @c size elemenata.
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Vrsi inicijalizaciju strukture za red za cekanje
+ * @param       queue                   Pokazivac na tek kreirani red cekanja,
+ * @param       memBuff                 memorijska oblast koja se koristi,
+ * @param       size                    velicina potrebnog reda cekanja izrazena
+ *                                      u broju elemenata u redu za cekanje,
+ *                                      mora biti stepen dvojke.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esQPow2Init_(
+    esQPow2_T *     queue,
+    uint8_t *       memBuff,
+    size_t          size) {
+
+    queue->buff = memBuff;
+    queue->head = 0U;
+    queue->tail = 0U;
+    queue->mask = size - 1U;
+}
+
+/**
+ * @brief       Destruktor funkcija za red za cekanje
+ * @param       queue                   Red za cekanje koji treba da se unisti.
+ * @return      Pocetak bafera reda za cekanje.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void * esQPow2DeInit_(
+    esQPow2_T *     queue) {
+
+    uint8_t * buff;
+
+    buff = queue->buff;
+    queue->buff = (uint8_t *)0U;
+    queue->head = 0U;
+    queue->tail = 0U;
+    queue->mask = 0U;
+
+    return ((void *)buff);
+}
+
+/**
+ * @brief       Postavlja element @b na @b kraju reda (tail) za cekanje (FIFO
+ *              metod)
+ * @param       queue                   Red cekanja gde treba postaviti dogadjaj,
+ * @param       item                    element koji treba postaviti u red za
+ *                                      cekanje.
+ * @pre         Red za cekanje je prethodno kreiran init funkcijom
+ *              esQPow2Init_().
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esQPow2Put_(
+    esQPow2_T *     queue,
+    uint8_t         item) {
+
+    queue->buff[queue->tail & queue->mask] = item;
+    ++queue->tail;
+}
+
+/**
+ * @brief       Postavlja dogadjaj @b na pocetku @b reda (head) za cekanje (LIFO
+ *              metod)
+ * @param       queue                   Red cekanja gde treba postaviti dogadjaj,
+ * @param       item                    element koji treba postaviti u red za
+ *                                      cekanje.
+ * @pre         Red za cekanje je prethodno kreiran init funkcijom
+ *              esQPow2Init_().
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS void esQPow2PutAhead_(
+    esQPow2_T *     queue,
+    uint8_t         item) {
+
+    --queue->head;
+    queue->buff[queue->head & queue->mask] = item;
+}
+
+/**
+ * @brief       Dobavlja element sa pocetka reda (head) za cekanje
+ * @param       queue                   Red za cekanje odakle treba dobaviti
+ *                                      element.
+ * @return      Element iz reda za cekanje.
+ * @pre         Red za cekanje je prethodno kreiran init funkcijom
+ *              esQPow2Init_().
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS uint8_t esQPow2Get_(
+    esQPow2_T *     queue) {
+
+    uint8_t tmp;
+
+    tmp = queue->buff[queue->head & queue->mask];
+    ++queue->head;
+
+    return (tmp);
+}
+
+/**
+ * @brief       Dobavlja koliko maksimalno elemenata moze da stane u red za
+ *              cekanje
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Maksimalan broj elemenata koji mogu da stanu u red za cekanje
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS size_t esQPow2Size_(
+    const esQPow2_T * queue) {
+
+    return (queue->mask + 1U);
+}
+
+/**
+ * @brief       Dobavlja velicinu reda za cekanje
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Trenutni broj elemenata u redu za cekanje.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS size_t esQPow2Occupied_(
+    const esQPow2_T * queue) {
+
+    return (queue->tail - queue->head);
+}
+
+/**
+ * @brief       Dobavlja koliko jos elemenata moze da se smesti u red za cekanje
+ * @param       queue                   Red za cekanje koji se ispituje
+ * @return      Koliko slobodnog prostora je preostalo.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS size_t esQPow2FreeSpace_(
+    const esQPow2_T * queue) {
+
+    return (queue->mask + 1U - (queue->tail - queue->head));
+}
+
+/**
+ * @brief       Vraca da li je red za cekanje pun
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Da li je red za cekanje pun?
+ *  @retval     TRUE - red za cekanje je pun
+ *  @retval     FALSE - red za cekanje nije pun
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS bool_T esQPow2IsFull_(
+    const esQPow2_T * queue) {
+
+    return ((bool_T)(queue->mask < (queue->tail - queue->head)));
+}
+
+/**
+ * @brief       Vraca da li je red za cekanje prazan
+ * @param       queue                   Red za cekanje koji se ispituje.
+ * @return      Da li je red za cekanje prazan?
+ *  @retval     TRUE - red cekanja je prazan
+ *  @retval     FALSE - red cekanaj nije prazan
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS bool_T esQPow2IsEmpty_(
+    const esQPow2_T * queue) {
+
+    return ((bool_T)(queue->tail == queue->head));
+}
+
 /** @} *//*-----------------------------------------------  C++ extern end  --*/
 #ifdef __cplusplus
 }
@@ -0,0 +1,542 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author  	Nenad Radulovic
+ * @brief       Implementation of POSIX host cpu port
+ * @addtogroup  linux-gcc-posix
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#define _GNU_SOURCE
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "arch/compiler.h"
+#include "arch/cpu.h"
+#include "eds/tem.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Period of the system tick in nanoseconds
+ */
+#define SYSTMR_PERIOD_NS                (1000000000ULL / CFG_SYSTMR_EVENT_FREQUENCY)
+/*======================================================  LOCAL DATA TYPES  ==*/
+
+/**@brief       Arguments passed to a new dispatcher thread
+ */
+struct cpuStart {
+    void (* entry)(uint_fast8_t);                                               /**< @brief Function executed by the thread                 */
+    uint_fast8_t    cpu;                                                        /**< @brief Kernel CPU identifier                           */
+};
+
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static void * cpuTrampoline(
+    void *          arg);
+
+#if (1U == OPT_TEM_ENABLE)
+static void * sysTmrThread(
+    void *          arg);
+#endif
+
+static uint64_t sysTmrElapsed(
+    void);
+
+static void sysTmrSet(
+    uint64_t        tick,
+    uint64_t        interval);
+
+static void sysTmrCatchUpI(
+    void);
+
+static uint64_t clockNow(
+    void);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+/**@brief       Process wide lock which simulates interrupt masking
+ */
+static pthread_mutex_t gIntLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**@brief       Critical section nesting level of this thread
+ */
+static __thread portReg_T gIntNesting;
+
+/**@brief       Signal mask of this thread before the outermost critical section
+ */
+static __thread sigset_t gIntSigMask;
+
+/**@brief       File descriptor of the system timer
+ */
+static int gSysTmrFd = -1;
+
+/**@brief       Is the system timer interrupt enabled
+ */
+static int gSysTmrIsEnabled;
+
+/**@brief       Origin of the system tick grid on @c CLOCK_MONOTONIC
+ */
+static struct timespec gSysTmrStart;
+
+/**@brief       Number of ticks delivered to the kernel
+ * @details     Accessed only from the critical section.
+ */
+static uint64_t gSysTmrTicks;
+
+/**@brief       Futex word on which idle dispatchers sleep
+ * @details     Every wake-up increments the word, so a dispatcher which read
+ *              it before leaving the critical section cannot miss a wake-up.
+ */
+static int gIdleSeq;
+
+/**@brief       Futex word on which blocked producers sleep
+ */
+static int gWaitSeq;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+
+__thread uint_fast8_t gPortCpuId_;
+
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+/**@brief       Entry point of a dispatcher thread
+ */
+static void * cpuTrampoline(
+    void *          arg) {
+
+    struct cpuStart start;
+
+    start = *(struct cpuStart *)arg;
+    free(arg);
+    gPortCpuId_ = start.cpu;
+
+#if (1U == CFG_CPU_AFFINITY)
+    {
+        cpu_set_t   cpuSet;
+
+        CPU_ZERO(&cpuSet);
+        CPU_SET(start.cpu, &cpuSet);
+        (void)pthread_setaffinity_np(
+            pthread_self(),
+            sizeof(cpuSet),
+            &cpuSet);
+    }
+#endif
+    start.entry(start.cpu);
+
+    return (NULL);
+}
+
+#if (1U == OPT_TEM_ENABLE)
+/**@brief       Body of the system timer thread
+ * @details     The thread blocks in @c read() until the timer expires. The
+ *              number of ticks to deliver is not taken from the expiration
+ *              count but from @c CLOCK_MONOTONIC, so ticks skipped while the
+ *              timer was suppressed are delivered as well.
+ */
+static void * sysTmrThread(
+    void *          arg) {
+
+    (void)arg;
+
+    for (;;) {
+        uint64_t    expirations;
+
+        if (sizeof(expirations) == read(gSysTmrFd, &expirations, sizeof(expirations))) {
+            portSysTmr();
+        }
+    }
+
+    return (NULL);
+}
+#endif
+
+/**@brief       Return the number of tick periods since the timer was started
+ */
+static uint64_t sysTmrElapsed(
+    void) {
+
+    struct timespec now;
+    uint64_t        elapsed;
+
+    (void)clock_gettime(
+        CLOCK_MONOTONIC,
+        &now);
+    elapsed  = (uint64_t)(now.tv_sec - gSysTmrStart.tv_sec) * 1000000000ULL;
+    elapsed += (uint64_t)now.tv_nsec;
+    elapsed -= (uint64_t)gSysTmrStart.tv_nsec;
+
+    return (elapsed / SYSTMR_PERIOD_NS);
+}
+
+/**@brief       Return the time on @c CLOCK_MONOTONIC in nanoseconds
+ */
+static uint64_t clockNow(
+    void) {
+
+    struct timespec now;
+
+    (void)clock_gettime(
+        CLOCK_MONOTONIC,
+        &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+}
+
+/**@brief       Program the timer to expire at tick @c tick of the tick grid
+ * @param       tick
+ *              Absolute tick number, 0 disarms the timer.
+ * @param       interval
+ *              Period in ticks after the first expiration, 0 for one-shot.
+ */
+static void sysTmrSet(
+    uint64_t        tick,
+    uint64_t        interval) {
+
+    struct itimerspec spec;
+    uint64_t        ns;
+
+    spec.it_interval.tv_sec  = (time_t)((interval * SYSTMR_PERIOD_NS) / 1000000000ULL);
+    spec.it_interval.tv_nsec = (long)((interval * SYSTMR_PERIOD_NS) % 1000000000ULL);
+
+    if (0U == tick) {
+        spec.it_value.tv_sec  = 0;
+        spec.it_value.tv_nsec = 0;
+    } else {
+        ns = (uint64_t)gSysTmrStart.tv_nsec + (tick * SYSTMR_PERIOD_NS);
+        spec.it_value.tv_sec  = gSysTmrStart.tv_sec + (time_t)(ns / 1000000000ULL);
+        spec.it_value.tv_nsec = (long)(ns % 1000000000ULL);
+    }
+    (void)timerfd_settime(
+        gSysTmrFd,
+        TFD_TIMER_ABSTIME,
+        &spec,
+        NULL);
+}
+
+/**@brief       Deliver all ticks which have elapsed but were not delivered
+ * @details     Must be called from the critical section. The tick counter is
+ *              advanced before the kernel is called, because the kernel may
+ *              re-arm a suppressed timer relative to it.
+ */
+static void sysTmrCatchUpI(
+    void) {
+
+    uint64_t        elapsed;
+    uint64_t        ticks;
+
+    elapsed = sysTmrElapsed();
+
+    if (gSysTmrTicks < elapsed) {
+        ticks = elapsed - gSysTmrTicks;
+        gSysTmrTicks = elapsed;
+#if (1U == OPT_TEM_ENABLE)
+
+        if (0 != __atomic_load_n(&gSysTmrIsEnabled, __ATOMIC_ACQUIRE)) {
+
+            while (UINT32_MAX < ticks) {
+                esTemTickNI(
+                    (esTick_T)UINT32_MAX);
+                ticks -= UINT32_MAX;
+            }
+            esTemTickNI(
+                (esTick_T)ticks);
+        }
+#else
+        (void)ticks;
+#endif
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void portIntDisable_(
+    void) {
+
+    sigset_t        all;
+
+    (void)sigfillset(&all);
+    (void)pthread_sigmask(
+        SIG_BLOCK,
+        &all,
+        NULL);
+}
+
+void portIntSet_(
+    portReg_T       val) {
+
+    gIntNesting = val;
+
+    if (0U == val) {
+        (void)pthread_mutex_unlock(
+            &gIntLock);
+        (void)pthread_sigmask(
+            SIG_SETMASK,
+            &gIntSigMask,
+            NULL);
+    }
+}
+
+portReg_T portIntGetSet_(
+    void) {
+
+    portReg_T       nesting;
+
+    nesting = gIntNesting;
+
+    if (0U == nesting) {
+        sigset_t    all;
+
+        (void)sigfillset(&all);
+        (void)pthread_sigmask(
+            SIG_BLOCK,
+            &all,
+            &gIntSigMask);
+        (void)pthread_mutex_lock(
+            &gIntLock);
+    }
+    gIntNesting = nesting + 1U;
+
+    return (nesting);
+}
+
+void portCpuStart_(
+    uint_fast8_t    cpu,
+    void (* entry)(uint_fast8_t)) {
+
+    struct cpuStart * start;
+    pthread_t       thread;
+
+    start = malloc(sizeof(struct cpuStart));
+
+    if (NULL == start) {
+        abort();
+    }
+    start->entry = entry;
+    start->cpu   = cpu;
+
+    if (0 != pthread_create(&thread, NULL, cpuTrampoline, start)) {
+        abort();
+    }
+    (void)pthread_detach(
+        thread);
+}
+
+void portSysTmrInit_(
+    void) {
+
+    pthread_t       thread;
+
+    gSysTmrFd = timerfd_create(
+        CLOCK_MONOTONIC,
+        TFD_CLOEXEC);
+
+    if (0 > gSysTmrFd) {
+        abort();
+    }
+    (void)clock_gettime(
+        CLOCK_MONOTONIC,
+        &gSysTmrStart);
+    gSysTmrTicks = 0U;
+    sysTmrSet(
+        1U,
+        1U);
+#if (1U == OPT_TEM_ENABLE)
+
+    if (0 != pthread_create(&thread, NULL, sysTmrThread, NULL)) {
+        abort();
+    }
+    (void)pthread_detach(
+        thread);
+#else
+    (void)thread;
+#endif
+}
+
+void portSysTmrEnable_(
+    void) {
+
+    __atomic_store_n(&gSysTmrIsEnabled, 1, __ATOMIC_RELEASE);
+}
+
+void portSysTmrDisable_(
+    void) {
+
+    __atomic_store_n(&gSysTmrIsEnabled, 0, __ATOMIC_RELEASE);
+}
+
+void portSysTmrSuppress_(
+    uint32_t        ticks) {
+
+    if (0U == ticks) {
+        sysTmrSet(
+            0U,
+            0U);
+    } else {
+        sysTmrSet(
+            gSysTmrTicks + ticks,
+            0U);
+    }
+}
+
+void portSysTmrResume_(
+    void) {
+
+    sysTmrCatchUpI();
+    sysTmrSet(
+        gSysTmrTicks + 1U,
+        1U);
+}
+
+void portSysTmr(
+    void) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    sysTmrCatchUpI();
+    PORT_CRITICAL_EXIT();
+}
+
+void portCpuIdle_(
+    void) {
+
+    portReg_T       nesting;
+    int             seq;
+
+    seq = __atomic_load_n(&gIdleSeq, __ATOMIC_ACQUIRE);
+    nesting = gIntNesting;
+    portIntSet_(
+        0U);
+    (void)syscall(
+        SYS_futex,
+        &gIdleSeq,
+        FUTEX_WAIT_PRIVATE,
+        seq,
+        NULL,
+        NULL,
+        0);
+    (void)portIntGetSet_();
+    gIntNesting = nesting;
+}
+
+void portCpuWake_(
+    void) {
+
+    (void)__atomic_add_fetch(&gIdleSeq, 1, __ATOMIC_RELEASE);
+    (void)syscall(
+        SYS_futex,
+        &gIdleSeq,
+        FUTEX_WAKE_PRIVATE,
+        INT_MAX,
+        NULL,
+        NULL,
+        0);
+}
+
+uint64_t portWaitDeadline_(
+    uint32_t        ms) {
+
+    return (clockNow() + (uint64_t)ms * 1000000ULL);
+}
+
+uint_fast8_t portWaitUntil_(
+    uint64_t        deadline) {
+
+    struct timespec timeout;
+    portReg_T       nesting;
+    uint64_t        now;
+    int             seq;
+
+    seq = __atomic_load_n(&gWaitSeq, __ATOMIC_ACQUIRE);
+    now = clockNow();
+
+    if (now < deadline) {
+        timeout.tv_sec  = (time_t)((deadline - now) / 1000000000ULL);
+        timeout.tv_nsec = (long)((deadline - now) % 1000000000ULL);
+        nesting = gIntNesting;
+        portIntSet_(
+            0U);
+        (void)syscall(
+            SYS_futex,
+            &gWaitSeq,
+            FUTEX_WAIT_PRIVATE,
+            seq,
+            &timeout,
+            NULL,
+            0);
+        (void)portIntGetSet_();
+        gIntNesting = nesting;
+        now = clockNow();
+    }
+
+    return ((now >= deadline) ? 1U : 0U);
+}
+
+void portWaitWake_(
+    void) {
+
+    (void)__atomic_add_fetch(&gWaitSeq, 1, __ATOMIC_RELEASE);
+    (void)syscall(
+        SYS_futex,
+        &gWaitSeq,
+        FUTEX_WAKE_PRIVATE,
+        INT_MAX,
+        NULL,
+        NULL,
+        0);
+}
+
+void portCpuRelax_(
+    void) {
+
+    (void)sched_yield();
+}
+
+PORT_C_NORETURN void portTerm_(
+    void) {
+
+    exit(EXIT_SUCCESS);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (0UL == CFG_SYSTMR_EVENT_FREQUENCY) || (1000000000UL < CFG_SYSTMR_EVENT_FREQUENCY)
+# error "POSIX port: CFG_SYSTMR_EVENT_FREQUENCY must be in range 1 - 1000000000 Hz."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of cpu.c
+ ******************************************************************************/
@@ -0,0 +1,354 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author  	Nenad Radulovic
+ * @brief       Interface of POSIX host cpu port
+ * @addtogroup  linux-gcc-posix
+ * @brief       Interface of POSIX host cpu port
+ * @details     This port runs the kernel as an ordinary Linux process. Each
+ *              kernel CPU is a POSIX thread and interrupts are simulated with
+ *              POSIX signals. Critical sections block all signals in the
+ *              calling thread and acquire one process wide lock, so the
+ *              semantics of interrupt masking on a MCU are preserved across
+ *              all host threads.
+ *********************************************************************//** @{ */
+
+#if !defined(CPU_H_)
+#define CPU_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdint.h>
+
+#include "cpu_cfg.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/*------------------------------------------------------------------------*//**
+ * @name        Port constants
+ * @{ *//*--------------------------------------------------------------------*/
+
+#define PORT_DATA_WIDTH                 64U                                     /**< @brief General purpose registers are 64bit wide        */
+
+#define PORT_DATA_ALIGNMENT             8U                                      /**< @brief Data is aligned to 8 bytes boundary             */
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Interrupt management
+ * @{ *//*--------------------------------------------------------------------*/
+
+#define PORT_INT_DISABLE()              portIntDisable_()
+
+#define PORT_ISR_ENTER()                (void)0                                 /**< @brief This port does not need this function call      */
+
+#define PORT_ISR_EXIT()                 (void)0                                 /**< @brief This port does not need this function call      */
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Critical section management
+ * @{ *//*--------------------------------------------------------------------*/
+
+#define PORT_CRITICAL_DECL              portReg_T intStatus_                    /**< @brief Critical section nesting holder                 */
+
+#define PORT_CRITICAL_ENTER()                                                   \
+    do {                                                                        \
+        intStatus_ = portIntGetSet_();                                          \
+    } while (0U)
+
+#define PORT_CRITICAL_EXIT()            portIntSet_(intStatus_)
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Scheduler support
+ * @{ *//*--------------------------------------------------------------------*/
+
+#define PORT_FIND_LAST_SET(val)         portFindLastSet_(val)
+
+#define PORT_SYSTMR_INIT()              portSysTmrInit_()
+
+#define PORT_SYSTMR_ISR_ENABLE()        portSysTmrEnable_()
+
+#define PORT_SYSTMR_ISR_DISABLE()       portSysTmrDisable_()
+
+/**@brief       Stop periodic ticks, next tick interrupt comes after @c ticks
+ *              ticks, or never when @c ticks is 0
+ */
+#define PORT_SYSTMR_SUPPRESS(ticks)     portSysTmrSuppress_(ticks)
+
+/**@brief       Deliver skipped ticks and restart periodic ticks
+ */
+#define PORT_SYSTMR_RESUME()            portSysTmrResume_()
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Multi-core support
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Return the identifier of the kernel CPU executing the caller
+ */
+#define PORT_CPU_ID()                   portCpuId_()
+
+/**@brief       Start function @c entry on kernel CPU @c cpu
+ * @details     The function is executed in a new host thread and it receives
+ *              the CPU identifier as argument.
+ */
+#define PORT_CPU_START(cpu, entry)      portCpuStart_(cpu, entry)
+
+/**@brief       Hint that the calling CPU has nothing to do
+ */
+#define PORT_CPU_RELAX()                portCpuRelax_()
+
+/**@brief       Sleep until PORT_CPU_WAKE() is called
+ * @details     Must be called from the outermost critical section. The critical
+ *              section is left while sleeping and entered again before return.
+ */
+#define PORT_CPU_IDLE()                 portCpuIdle_()
+
+/**@brief       Wake up all CPUs sleeping in PORT_CPU_IDLE()
+ */
+#define PORT_CPU_WAKE()                 portCpuWake_()
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Blocking producer support
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Return the deadline which expires after @c ms milliseconds
+ */
+#define PORT_WAIT_DEADLINE(ms)          portWaitDeadline_(ms)
+
+/**@brief       Sleep until PORT_WAIT_WAKE() is called or @c deadline expires
+ * @details     Must be called from the outermost critical section. The critical
+ *              section is left while sleeping and entered again before return.
+ *              Returns non-zero when the deadline has expired.
+ */
+#define PORT_WAIT_UNTIL(deadline)       portWaitUntil_(deadline)
+
+/**@brief       Wake up all threads sleeping in PORT_WAIT_UNTIL()
+ */
+#define PORT_WAIT_WAKE()                portWaitWake_()
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Generic port macros
+ * @{ *//*--------------------------------------------------------------------*/
+
+#define PORT_INIT_EARLY()               (void)0                                 /**< @brief This port does not need this function call      */
+
+#define PORT_INIT()                     (void)0                                 /**< @brief This port does not need this function call      */
+
+#define PORT_INIT_LATE()                (void)0                                 /**< @brief This port does not need this function call      */
+
+#define PORT_TERM()                     portTerm_()
+
+/** @} *//*---------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+typedef uint64_t portReg_T;                                                     /**< @brief General purpose registers are 64bit wide.       */
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+
+/**@brief       Identifier of the kernel CPU which is executed by this thread
+ */
+extern __thread uint_fast8_t gPortCpuId_;
+
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/*------------------------------------------------------------------------*//**
+ * @name        Interrupt management
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Disable interrupts
+ * @details     Blocks all signals in the calling thread.
+ */
+void portIntDisable_(
+    void);
+
+/**@brief       Restore the interrupt status
+ * @param       val
+ *              Critical section nesting level returned by portIntGetSet_()
+ * @details     When the outermost critical section is left the process wide
+ *              lock is released and the signal mask of the thread is restored.
+ */
+void portIntSet_(
+    portReg_T       val);
+
+/**@brief       Get current and set new interrupt status
+ * @return      Critical section nesting level before the call
+ * @details     When the outermost critical section is entered all signals are
+ *              blocked in the calling thread and the process wide lock is
+ *              acquired.
+ */
+portReg_T portIntGetSet_(
+    void);
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Scheduler support
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Find last set bit in a word
+ * @param       value
+ *              64 bit value which will be evaluated
+ * @return      Last set bit in a word
+ * @details     This implementation uses @c __builtin_clzll which is compiled
+ *              to @c lzcnt or @c bsr instruction and then it computes the
+ *              result using the following expression:
+ *              <code>fls(x) = w − clz(x)</code>.
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS uint_fast8_t portFindLastSet_(
+    portReg_T       value) {
+
+    return ((uint_fast8_t)(63U - (uint_fast8_t)__builtin_clzll(value)));
+}
+
+/**@brief       Initialize system timer
+ * @details     Creates the @c timerfd with period of
+ *              @ref CFG_SYSTMR_EVENT_FREQUENCY and the host thread which reads
+ *              it. Ticks are not delivered until portSysTmrEnable_() is called.
+ */
+void portSysTmrInit_(
+    void);
+
+/**@brief       Enable the system timer interrupt
+ */
+void portSysTmrEnable_(
+    void);
+
+/**@brief       Disable the system timer interrupt
+ */
+void portSysTmrDisable_(
+    void);
+
+/**@brief       Stop periodic system ticks
+ * @param       ticks
+ *              Number of ticks until the next timer interrupt, 0 if no
+ *              interrupt is needed.
+ * @details     Must be called from the critical section.
+ */
+void portSysTmrSuppress_(
+    uint32_t        ticks);
+
+/**@brief       Restart periodic system ticks
+ * @details     Ticks which elapsed while the timer was suppressed are
+ *              delivered to the kernel before return. Must be called from the
+ *              critical section.
+ */
+void portSysTmrResume_(
+    void);
+
+/**@brief       System timer event handler
+ * @details     Called by the system timer thread on each expiration of the
+ *              @c timerfd. It enters the critical section and passes to the
+ *              kernel all ticks elapsed since the last call. When ticks are
+ *              suppressed the kernel re-arms the timer from the same call.
+ */
+void portSysTmr(
+    void);
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Multi-core support
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Return the identifier of the kernel CPU executing the caller
+ * @inline
+ */
+static PORT_C_INLINE_ALWAYS uint_fast8_t portCpuId_(
+    void) {
+
+    return (gPortCpuId_);
+}
+
+/**@brief       Start function @c entry in a new host thread
+ * @param       cpu
+ *              Kernel CPU identifier, it is passed to @c entry
+ * @param       entry
+ *              Function which is executed by the new thread
+ */
+void portCpuStart_(
+    uint_fast8_t    cpu,
+    void (* entry)(uint_fast8_t));
+
+/**@brief       Yield the host core to other threads
+ */
+void portCpuRelax_(
+    void);
+
+/**@brief       Sleep on a futex until portCpuWake_() is called
+ * @details     The futex word is read before the critical section is left, so
+ *              a wake-up issued after that point is never lost.
+ */
+void portCpuIdle_(
+    void);
+
+/**@brief       Wake up all threads sleeping in portCpuIdle_()
+ */
+void portCpuWake_(
+    void);
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Blocking producer support
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Compute the deadline on @c CLOCK_MONOTONIC
+ * @param       ms
+ *              Number of milliseconds from now
+ * @return      Deadline in nanoseconds
+ */
+uint64_t portWaitDeadline_(
+    uint32_t        ms);
+
+/**@brief       Sleep on a futex until portWaitWake_() is called or the
+ *              deadline expires
+ * @param       deadline
+ *              Deadline returned by portWaitDeadline_()
+ * @return      Non-zero when the deadline has expired
+ * @details     The futex word is read before the critical section is left, so
+ *              a wake-up issued after that point is never lost.
+ */
+uint_fast8_t portWaitUntil_(
+    uint64_t        deadline);
+
+/**@brief       Wake up all threads sleeping in portWaitUntil_()
+ */
+void portWaitWake_(
+    void);
+
+/**@} *//*----------------------------------------------------------------*//**
+ * @name        Generic port functions
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Terminate the host process
+ */
+PORT_C_NORETURN void portTerm_(
+    void);
+
+/** @} *//*-----------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of cpu.h
+ ******************************************************************************/
+#endif /* CPU_H_ */
@@ -0,0 +1,85 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author  	Nenad Radulovic
+ * @brief       Configuration of POSIX host cpu port
+ * @addtogroup  linux-gcc-posix_cfg
+ * @brief		Configuration of CPU module.
+ * @details     Each configuration option or setting has its own default value
+ *              when not defined by the application. When application needs to
+ *              change a setting it just needs to define a configuration macro
+ *              with another value and the default configuration macro will be
+ *              overridden.
+ *********************************************************************//** @{ */
+
+#ifndef CPU_CFG_H_
+#define CPU_CFG_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+/*===============================================================  DEFINES  ==*/
+/** @cond */
+
+/** @endcond */
+/*==============================================================  SETTINGS  ==*/
+
+/*------------------------------------------------------------------------*//**
+ * @name        POSIX host
+ * @{ *//*--------------------------------------------------------------------*/
+
+#define CPU_FOUND_                                                              /**< @brief Note that a port is found.                      */
+
+/**@brief       Pin each kernel dispatcher thread to its own host core
+ * @details     When this option is turned on the dispatcher thread which
+ *              executes kernel CPU @c n is bound to host core @c n using
+ *              @c pthread_setaffinity_np(). This gives more stable results
+ *              when measuring kernel scaling.
+ *              - 0 - threads are scheduled freely by the host
+ *              - 1 - threads are pinned to host cores
+ */
+#if !defined(CFG_CPU_AFFINITY) || defined(__DOXYGEN__)
+# define CFG_CPU_AFFINITY               1U
+#endif
+
+/**@brief       The frequency of system tick event
+ * @details     The system timer is a @c timerfd of @c CLOCK_MONOTONIC which
+ *              is read by a dedicated host thread. Each expiration is
+ *              delivered to the kernel as one system timer interrupt. When the
+ *              host falls behind, missed expirations are delivered in a burst
+ *              so the tick count never drifts.
+ */
+#if !defined(CFG_SYSTMR_EVENT_FREQUENCY) || defined(__DOXYGEN__)
+# define CFG_SYSTMR_EVENT_FREQUENCY     1000UL
+#endif
+
+/** @} *//*-------------------------------------------------------------------*/
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if !defined(CPU_FOUND_)
+# error "Kernel CPU port: please define a valid port macro."
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of cpu_cfg.h
+ ******************************************************************************/
+#endif /* CPU_CFG_H_ */
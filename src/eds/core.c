@@ -36,6 +36,10 @@
 #include "arch/cpu.h"
 #include "../config/kernel_config.h"
 
+#if (0U == OPT_MEM_DYN_EXTERN) && (1U == OPT_MEM_DYN_TLSF)
+# include "eds/tlsf.h"
+#endif
+
 /*=========================================================  LOCAL DEFINES  ==*/
 
 /**
@@ -53,64 +57,206 @@
 /*------------------------------------------------------------------------*//**
  * @ingroup     Pomocni makroi za rad sa bitmapom
  * @{ *//*--------------------------------------------------------------------*/
-#if (OPT_KERNEL_EPA_PRIO_MAX <= PORT_DATA_WIDTH)
-# define PRIO_INDX                      OPT_KERNEL_EPA_PRIO_MAX
-# define PRIO_INDX_GROUP                1
+
+/**
+ * @brief       Broj bita prioriteta koji se razresava na jednom nivou bitmape
+ */
+#define PRIO_INDX_PWR                   GP_UINT8_LOG2(PORT_DATA_WIDTH)
+
+/**
+ * @brief       Maska bita prioriteta unutar jedne reci bitmape
+ */
+#define PRIO_INDX_MASK                  ((uint_fast16_t)PORT_DATA_WIDTH - 1U)
+
+/**
+ * @brief       Broj nivoa bitmape
+ * @details     Svaki nivo smanjuje broj prioriteta koji se pretrazuju
+ *              @c PORT_DATA_WIDTH puta, tako da 64-bitnom procesoru za 4096
+ *              prioriteta trebaju dva nivoa, a 32-bitnom tri.
+ */
+#if   (OPT_KERNEL_EPA_PRIO_MAX <= PORT_DATA_WIDTH)
+# define RDY_LEVELS                     1U
+#elif (OPT_KERNEL_EPA_PRIO_MAX <= (PORT_DATA_WIDTH * PORT_DATA_WIDTH))
+# define RDY_LEVELS                     2U
+#elif (OPT_KERNEL_EPA_PRIO_MAX <= (PORT_DATA_WIDTH * PORT_DATA_WIDTH * PORT_DATA_WIDTH))
+# define RDY_LEVELS                     3U
+#else
+# define RDY_LEVELS                     4U
+#endif
+
+/**
+ * @brief       Broj reci na nivou @c lvl bitmape, nivo 0 je najvisi nivo
+ */
+#define RDY_LVL_WORDS(lvl)                                                      \
+    GP_DIV_ROUNDUP(OPT_KERNEL_EPA_PRIO_MAX, 1UL << (PRIO_INDX_PWR * (RDY_LEVELS - (lvl))))
+
+#define RDY_LVL_OFFSET_1                1U
+#define RDY_LVL_OFFSET_2                (RDY_LVL_OFFSET_1 + RDY_LVL_WORDS(1U))
+#define RDY_LVL_OFFSET_3                (RDY_LVL_OFFSET_2 + RDY_LVL_WORDS(2U))
+
+/**
+ * @brief       Ukupan broj reci bitmape
+ */
+#if   (1U == RDY_LEVELS)
+# define RDY_WORDS                      1U
+#elif (2U == RDY_LEVELS)
+# define RDY_WORDS                      (RDY_LVL_OFFSET_1 + RDY_LVL_WORDS(1U))
+#elif (3U == RDY_LEVELS)
+# define RDY_WORDS                      (RDY_LVL_OFFSET_2 + RDY_LVL_WORDS(2U))
+#else
+# define RDY_WORDS                      (RDY_LVL_OFFSET_3 + RDY_LVL_WORDS(3U))
+#endif
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @ingroup     Pomocni makroi za rad sa vise jezgara
+ * @{ *//*--------------------------------------------------------------------*/
+#if (1U < OPT_KERNEL_CPU_NUM)
+# define CPU_ID()                       PORT_CPU_ID()
+# define EPA_RDY_BITMAP(epa)            (&gRdyBitmap[(epa)->cpu])
 #else
-# define PRIO_INDX                      PORT_DATA_WIDTH
-# define PRIO_INDX_GROUP                (ES_DIV_ROUNDUP(OPT_KERNEL_EPA_PRIO_MAX, PRIO_INDX))
+# define CPU_ID()                       0U
+# define EPA_RDY_BITMAP(epa)            (&gRdyBitmap[0])
 #endif
-#define PRIO_INDX_PWR                   ES_UINT8_LOG2(PRIO_INDX)
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @ingroup     Pomocni makroi za EPN mrezu
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Broj reci bitmape pretplatnika jednog signala
+ */
+#define EPN_WORDS                                                               \
+    GP_DIV_ROUNDUP(OPT_KERNEL_EPA_PRIO_MAX, PORT_DATA_WIDTH)
+
+/**
+ * @brief       Da li je EPA objekat @c epa pretplacen na signal @c id
+ */
+#define EPN_IS_SIGNAL(epa, id)                                                  \
+    ((portReg_T)0U != ((epa)->epnSignal[(id) >> PRIO_INDX_PWR] &                \
+        ((portReg_T)1U << ((id) & PRIO_INDX_MASK))))
+
+/**
+ * @brief       Bit prioriteta @c prio u reci bitmape pretplatnika
+ */
+#define EPN_PRIO_BIT(prio)                                                      \
+    ((portReg_T)1U << ((prio) & PRIO_INDX_MASK))
 
 /** @} *//*-------------------------------------------------------------------*/
 /*======================================================  LOCAL DATA TYPES  ==*/
 
 /**
  * @brief       Bitmap spremnih EPA objekata
+ * @details     Svako jezgro ima svoju bitmapu spremnih EPA objekata.
  */
 struct rdyBitmap {
-#if !(OPT_KERNEL_EPA_PRIO_MAX <= PORT_DATA_WIDTH) || defined(__DOXYGEN__)
 /**
- * @brief       Grupa prioriteta EPA objekata
- * @details     Prilikom trazenja sledeceg aktivnog EPA objekta prvo se
- *              pretrazuje ovaj clan.
- * @note        Ovaj clan se ne koristi kada uslov
- *              "OPT_KERNEL_EPA_PRIO_MAX < PORT_DATA_WIDTH" nije ispunjen. U
- *              tom slucaju, generisani kod je manji i efikasniji prilikom
- *              komutacije EPA objekata.
+ * @brief       Reci svih nivoa bitmape prioriteta
+ * @details     Nivoi su smesteni jedan za drugim, pocevsi od najviseg nivoa
+ *              koji uvek ima samo jednu rec (bit[0]). Bit @c n u reci @c w
+ *              nivoa @c lvl je postavljen kada je postavljena rec
+ *              <code>w * PORT_DATA_WIDTH + n</code> nivoa <code>lvl + 1</code>,
+ *              dok najnizi nivo sadrzi po jedan bit za svaki prioritet.
+ *              Pretraga zato uvek zahteva tacno @ref RDY_LEVELS poziva
+ *              PORT_FIND_LAST_SET() bez obzira na broj spremnih EPA objekata.
+ */
+    volatile portReg_T       bit[RDY_WORDS];
+
+/**
+ * @brief       Redovi spremnih EPA objekata, po jedan za svaki prioritet
+ * @details     Svi EPA objekti istog prioriteta koji su spremni za izvrsenje
+ *              se nalaze u jednoj DLS listi. Izvrsava se EPA objekat na pocetku
+ *              liste, a nakon obrade jednog dogadjaja EPA objekat se premesta
+ *              na kraj liste (round-robin).
+ */
+    esDlsList_T     list[OPT_KERNEL_EPA_PRIO_MAX];
+};
+
+/**
+ * @brief       Lokacija reda odlozenih dogadjaja
+ */
+struct evtDeferSlot {
+/**
+ * @brief       Odlozen dogadjaj
+ * @details     NULL oznacava dogadjaj po vrednosti, koji se cuva kao par
+ *              @c id i @c value jer je njegova struktura bila na steku
+ *              dispecera.
+ */
+    esEvt_T *       evt;
+#if (1U == OPT_KERNEL_EVT_VALUE)
+
+/**
+ * @brief       Identifikator dogadjaja po vrednosti
+ */
+    esEvtId_T       id;
+
+/**
+ * @brief       Vrednost dogadjaja po vrednosti
  */
-    volatile portReg_T       bitGroup;
+    uintptr_t       value;
 #endif
+};
+
+#if (0U != OPT_KERNEL_EVT_SPILL)
+/**
+ * @brief       Lokacija zajednickog prostora za prelivanje dogadjaja
+ */
+struct evtSpill {
+/**
+ * @brief       Clan liste prelivenih ili liste slobodnih lokacija
+ */
+    esSlsList_T     list;
 
 /**
- * @brief       Prioriteti EPA objekata
- * @details     Kad je pretragom bitGroup utvrdjeno da se ovde nalazi spreman
- *              EPA objekat, onda se pretraga nastavlja ovde.
+ * @brief       EPA objekat kome je dogadjaj poslat
  */
-    volatile portReg_T       bit[PRIO_INDX_GROUP];
+    esEpa_T *       epa;
 
 /**
- * @brief       Lista aktivnih EPA objekata;
+ * @brief       Preliven dogadjaj
+ * @details     Dogadjaj po vrednosti se cuva kao kodiran identifikator, isto
+ *              kao u redu cekanja.
  */
-    esEpa_T *       list[OPT_KERNEL_EPA_PRIO_MAX];
+    esEvt_T *       evt;
+# if (1U == OPT_KERNEL_EVT_VALUE)
+
+/**
+ * @brief       Vrednost dogadjaja po vrednosti
+ */
+    uintptr_t       value;
+# endif
 };
+#endif
 
 /*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
 
 static PORT_C_INLINE bool_T schedRdyIsEmptyI_(
-    void);
+    const struct rdyBitmap * rdyBitmap);
 
-static PORT_C_INLINE esEpa_T *schedRdyGetEpaI_(
-    void);
+static PORT_C_INLINE esEpa_T * schedRdyGetEpaI_(
+    const struct rdyBitmap * rdyBitmap);
+
+static PORT_C_INLINE esEpa_T * schedRdyNextI_(
+    uint_fast8_t    cpu);
+
+static PORT_C_INLINE void schedRdyBitSetI_(
+    struct rdyBitmap * rdyBitmap,
+    uint_fast16_t   prio);
+
+static PORT_C_INLINE void schedRdyBitClrI_(
+    struct rdyBitmap * rdyBitmap,
+    uint_fast16_t   prio);
 
 static PORT_C_INLINE bool_T schedRdyIsEpaRdy_(
     const esEpa_T * epa);
 
-static PORT_C_INLINE void schedRdyRegI_(
-    const esEpa_T * epa);
+static PORT_C_INLINE void schedRdyInsertI_(
+    esEpa_T *       epa);
 
-static PORT_C_INLINE void schedRdyUnRegI_(
-    const esEpa_T * epa);
+static PORT_C_INLINE void schedRdyRmI_(
+    esEpa_T *       epa);
+
+static PORT_C_INLINE void schedRdyRotateI_(
+    esEpa_T *       epa);
 
 static void schedInit(
     void);
@@ -119,20 +265,127 @@ static PORT_C_INLINE void epaInit_(
     esEpa_T *       epa,
     esState_T *     stateQueue,
     esEvt_T **      evtQueue,
+    size_t          evtQueueLevels,
+    esEvt_T **      urgentQueue,
+    size_t          urgentQueueLevels,
+    struct evtDeferSlot * deferQueue,
     const PORT_C_ROM esEpaDef_T * definition);
 
 static PORT_C_INLINE void esEpaDeInit_(
     esEpa_T *       epa);
 
-esEvt_T * evtFetchI(
+#if (1U == OPT_KERNEL_EVT_VALUE)
+uint_fast8_t evtFetchI(
+    esEpa_T *       epa,
+    esEvt_T **      evtBuff,
+    esEvtValue_T *  valueBuff);
+#else
+uint_fast8_t evtFetchI(
+    esEpa_T *       epa,
+    esEvt_T **      evtBuff);
+#endif
+
+static PORT_C_INLINE void epaReleaseI_(
+    esEpa_T *       epa);
+
+static PORT_C_INLINE bool_T epaIsIdleI_(
+    esEpa_T *       epa);
+
+static PORT_C_INLINE bool_T epaEvtQIsEmptyI_(
+    esEpa_T *       epa);
+
+static PORT_C_INLINE bool_T epaEvtPutI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+static PORT_C_INLINE bool_T epaValuePutI_(
+    esEpa_T *       epa,
+    esEvtId_T       id,
+    uintptr_t       value);
+#endif
+
+static void epaDeferI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+#if (0U != OPT_KERNEL_EVT_SPILL)
+static void spillInit(
+    void);
+
+static bool_T epaSpillPutI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt,
+    uintptr_t       value,
+    bool_T          isAhead);
+
+static void epaSpillRefillI_(
+    esEpa_T *       epa);
+
+static esEvt_T * epaSpillReplaceI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt);
+
+static void epaSpillDeInit_(
+    esEpa_T *       epa);
+#endif
+
+static void kernelDispatch(
+    uint_fast8_t    cpu);
+
+#if defined(PORT_CPU_IDLE)
+static PORT_C_INLINE void kernelIdleI_(
+    void);
+#endif
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+static PORT_C_INLINE void epaWakeI_(
+    esEpa_T *       epa);
+
+static void evtPostLf(
+    esEpa_T *       epa,
+    evtQueue_T *    evtQ,
+    esEvt_T *       evt);
+#endif
+
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
+static bool_T epnIsSubscriberI_(
+    const esEpa_T * epa);
+
+static void epnPrioUpdateI_(
+    uint_fast16_t   prio,
+    esEvtId_T       id);
+
+static void epnLinkI_(
+    esEpa_T *       epa);
+
+static void epnUnlinkI_(
     esEpa_T *       epa);
+#endif
 
 /*=======================================================  LOCAL VARIABLES  ==*/
 
 /**
- * @brief       Pokazivac na EPA objekat koji se trenutno izvrsava
+ * @brief       Pocetak svakog nivoa u nizu rdyBitmap::bit
+ */
+static const PORT_C_ROM uint_fast16_t gRdyLvlOffset[RDY_LEVELS] = {
+    0U
+#if (2U <= RDY_LEVELS)
+    , RDY_LVL_OFFSET_1
+#endif
+#if (3U <= RDY_LEVELS)
+    , RDY_LVL_OFFSET_2
+#endif
+#if (4U <= RDY_LEVELS)
+    , RDY_LVL_OFFSET_3
+#endif
+};
+
+/**
+ * @brief       Pokazivaci na EPA objekte koji se trenutno izvrsavaju na
+ *              pojedinim jezgrima
  */
-static esEpa_T * gCurrentEpa;
+static esEpa_T * gCurrentEpa[OPT_KERNEL_CPU_NUM];
 
 /**
  * @brief       Trenutno stanje kernel-a
@@ -140,9 +393,64 @@ static esEpa_T * gCurrentEpa;
 static esKernelState_T gKernelState;
 
 /**
- * @brief       Bitmape spremnih EPA objekata
+ * @brief       Bitmape spremnih EPA objekata, jedna za svako jezgro
+ */
+static struct rdyBitmap gRdyBitmap[OPT_KERNEL_CPU_NUM];
+
+#if defined(PORT_CPU_IDLE)
+/**
+ * @brief       Broj jezgara koja spavaju u PORT_CPU_IDLE()
  */
-static struct rdyBitmap gRdyBitmap;
+static uint_fast8_t gIdleCpuNum;
+#endif
+
+#if defined(PORT_WAIT_UNTIL)
+/**
+ * @brief       Broj niti proizvodjaca koje cekaju u esEvtPostTimed()
+ */
+static uint_fast16_t gPostWaitNum;
+#endif
+
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
+/**
+ * @brief       Bitmape pretplatnika, jedna za svaki signal
+ * @details     Bit @c prio je postavljen kada je EPA objekat prioriteta @c prio
+ *              pretplacen na signal.
+ */
+static portReg_T gEpnSubscr[OPT_KERNEL_EPN_SIGNAL_MAX][EPN_WORDS];
+
+/**
+ * @brief       Liste EPA objekata pretplatnika, indeksirane prioritetom
+ * @details     Lista sadrzi sve EPA objekte datog prioriteta koji su
+ *              pretplaceni na barem jedan signal, povezane preko
+ *              @c epnNext.
+ */
+static esEpa_T * gEpnEpa[OPT_KERNEL_EPA_PRIO_MAX];
+#endif
+
+#if (0U != OPT_KERNEL_EVT_SPILL)
+/**
+ * @brief       Zajednicki prostor za prelivanje dogadjaja
+ */
+static struct evtSpill gSpill[OPT_KERNEL_EVT_SPILL];
+
+/**
+ * @brief       Lista slobodnih lokacija prostora za prelivanje
+ */
+static esSlsList_T gSpillFree;
+
+/**
+ * @brief       Lista prelivenih dogadjaja svih EPA objekata
+ * @details     Dogadjaji su poredjani redom kojim su preliveni, pa se
+ *              dogadjaji jednog EPA objekta vracaju u red istim redosledom.
+ */
+static esSlsList_T gSpillList;
+
+/**
+ * @brief       Poslednji clan liste prelivenih dogadjaja
+ */
+static esSlsList_T * gSpillTail;
+#endif
 
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
@@ -157,66 +465,162 @@ static struct rdyBitmap gRdyBitmap;
 static void schedInit(
     void) {
 
-    gCurrentEpa = (esEpa_T *)0U;
+    uint_fast8_t cpu;
+
+    for (cpu = 0U; cpu < OPT_KERNEL_CPU_NUM; cpu++) {
+        uint_fast16_t prio;
+
+        for (prio = 0U; prio < OPT_KERNEL_EPA_PRIO_MAX; prio++) {
+            esDlsSentinelInit_(
+                &gRdyBitmap[cpu].list[prio]);
+        }
+        gCurrentEpa[cpu] = (esEpa_T *)0U;
+    }
     gKernelState = KERNEL_STOPPED;
 }
 
 /**
  * @brief       Vraca stanje reda za cekanje.
+ * @param       [in] rdyBitmap          Bitmapa spremnih EPA objekata jezgra
  * @return      Boolean vrednost koja karakterise stanje reda za cekanje
  *  @retval     TRUE - ne postoji EPA objekat koji ceka izvrsavanje,
  *  @retval     FALSE - postoji barem jedan EPA objekat koji ceka izvrsavanje.
  */
 static PORT_C_INLINE bool_T schedRdyIsEmptyI_(
-    void) {
-
-#if (OPT_KERNEL_EPA_PRIO_MAX <= PORT_DATA_WIDTH)
-    bool_T answer;
+    const struct rdyBitmap * rdyBitmap) {
 
-    if ((portReg_T)0U == gRdyBitmap.bit[0]) {
-        answer = TRUE;
-    } else {
-        answer = FALSE;
-    }
-
-    return (answer);
-#else
     bool_T answer;
 
-    if ((portReg_T)0U == gRdyBitmap.bitGroup) {
+    if ((portReg_T)0U == rdyBitmap->bit[0]) {
         answer = TRUE;
     } else {
         answer = FALSE;
     }
 
     return (answer);
-#endif
 }
 
 /**
  * @brief       Vraca pokazivac na sledeci EPA objekat sa najvecim prioritetom.
+ * @param       [in] rdyBitmap          Bitmapa spremnih EPA objekata jezgra
  * @return      EPA objekat sa najvecim prioritetom koji ceka na izvrsenje.
+ * @details     Pretraga pocinje od najviseg nivoa bitmape i na svakom nivou
+ *              pronadjeni bit odredjuje rec sledeceg nivoa. Broj iteracija je
+ *              konstantan i kompajler petlju razvija.
  */
 static PORT_C_INLINE esEpa_T * schedRdyGetEpaI_(
-    void) {
+    const struct rdyBitmap * rdyBitmap) {
+
+    uint_fast16_t prio;
+    uint_fast8_t lvl;
+    esEpa_T * epa;
 
-#if (OPT_KERNEL_INTERRUPT_PRIO_MAX < PORT_DATA_WIDTH)
-    esEpa_T *epa;
+    prio = 0U;
 
-    epa = gRdyBitmap.list[esCpuFindLastSet(gRdyBitmap.bit[0])];
+    for (lvl = 0U; lvl < RDY_LEVELS; lvl++) {
+        prio = (prio << PRIO_INDX_PWR) |
+            PORT_FIND_LAST_SET(rdyBitmap->bit[gRdyLvlOffset[lvl] + prio]);
+    }
+    epa = ES_DLS_NODE_ENTRY(
+        esEpa_T,
+        rdyList,
+        rdyBitmap->list[prio].next);
 
     return (epa);
-#else
-    portReg_T indxGroup;
-    portReg_T indx;
+}
+
+/**
+ * @brief       Vraca sledeci EPA objekat koji treba da izvrsi jezgro @c cpu
+ * @param       cpu                     Identifikator jezgra
+ * @return      EPA objekat sa najvecim prioritetom iz bitmape jezgra. Ukoliko
+ *              je bitmapa jezgra prazna, u SMP rezimu se preuzima EPA objekat
+ *              sa najvecim prioritetom sa prvog sledeceg jezgra koje ima
+ *              spremne EPA objekte.
+ *  @retval     NULL - ne postoji spreman EPA objekat.
+ */
+static PORT_C_INLINE esEpa_T * schedRdyNextI_(
+    uint_fast8_t    cpu) {
+
     esEpa_T * epa;
 
-    indxGroup = ES_CPU_FLS(gRdyBitmap.bitGroup);
-    indx = ES_CPU_FLS(gRdyBitmap.bit[indxGroup]);
-    epa = gRdyBitmap.list[indx | (indxGroup << PRIO_INDX_PWR)];
+    epa = (esEpa_T *)0U;
 
-    return (epa);
+    if (FALSE == schedRdyIsEmptyI_(&gRdyBitmap[cpu])) {
+        epa = schedRdyGetEpaI_(
+            &gRdyBitmap[cpu]);
+    }
+#if (1U < OPT_KERNEL_CPU_NUM)
+    else {
+        uint_fast8_t victim;
+
+        victim = cpu + 1U;
+
+        while (((esEpa_T *)0U == epa) && (victim != cpu)) {
+
+            if (OPT_KERNEL_CPU_NUM == victim) {
+                victim = 0U;
+            } else {
+
+                if (FALSE == schedRdyIsEmptyI_(&gRdyBitmap[victim])) {
+                    epa = schedRdyGetEpaI_(
+                        &gRdyBitmap[victim]);
+                }
+                victim++;
+            }
+        }
+    }
+#else
+    (void)cpu;
 #endif
+
+    return (epa);
+}
+
+/**
+ * @brief       Postavlja bit prioriteta @c prio u bitmapi
+ * @param       [out] rdyBitmap         Bitmapa spremnih EPA objekata jezgra,
+ * @param       prio                    prioritet koji je postao spreman.
+ * @details     Bit se postavlja na svim nivoima bitmape, od najnizeg ka
+ *              najvisem.
+ */
+static PORT_C_INLINE void schedRdyBitSetI_(
+    struct rdyBitmap * rdyBitmap,
+    uint_fast16_t   prio) {
+
+    uint_fast8_t lvl;
+
+    lvl = RDY_LEVELS;
+
+    do {
+        lvl--;
+        rdyBitmap->bit[gRdyLvlOffset[lvl] + (prio >> PRIO_INDX_PWR)] |=
+            (portReg_T)1U << (prio & PRIO_INDX_MASK);
+        prio >>= PRIO_INDX_PWR;
+    } while (0U != lvl);
+}
+
+/**
+ * @brief       Brise bit prioriteta @c prio u bitmapi
+ * @param       [out] rdyBitmap         Bitmapa spremnih EPA objekata jezgra,
+ * @param       prio                    prioritet koji vise nije spreman.
+ * @details     Bit na visem nivou se brise samo kada rec nizeg nivoa postane
+ *              prazna.
+ */
+static PORT_C_INLINE void schedRdyBitClrI_(
+    struct rdyBitmap * rdyBitmap,
+    uint_fast16_t   prio) {
+
+    volatile portReg_T * word;
+    uint_fast8_t lvl;
+
+    lvl = RDY_LEVELS;
+
+    do {
+        lvl--;
+        word = &rdyBitmap->bit[gRdyLvlOffset[lvl] + (prio >> PRIO_INDX_PWR)];
+        *word &= ~((portReg_T)1U << (prio & PRIO_INDX_MASK));
+        prio >>= PRIO_INDX_PWR;
+    } while ((0U != lvl) && ((portReg_T)0U == *word));
 }
 
 /**
@@ -226,305 +630,1857 @@ static PORT_C_INLINE esEpa_T * schedRdyGetEpaI_(
  * @return      Stanje navedenog EPA objekta
  *  @retval     TRUE - EPA objekat ceka na izvrsenje
  *  @retval     FALSE - EPA objekat ne ceka na izvrsenje
+ * @details     Clan rdyList EPA objekta koji nije u redu spremnih EPA objekata
+ *              uvek pokazuje sam na sebe.
  */
 static PORT_C_INLINE bool_T schedRdyIsEpaRdy_(
     const esEpa_T * epa) {
 
-#if (OPT_KERNEL_EPA_PRIO_MAX <= PORT_DATA_WIDTH)
     bool_T answer;
 
-    if (gRdyBitmap.bit[0] & ((portReg_T)1U << epa->prio)) {
+    if (&epa->rdyList != epa->rdyList.next) {
         answer = TRUE;
     } else {
         answer = FALSE;
     }
 
     return (answer);
-#else
-    portReg_T indxGroup;
-    portReg_T indx;
+}
+
+/**
+ * @brief       Ubacuje EPA objekat u red za cekanje.
+ * @param       [in] epa               Pokazivac na EPA objekat koji je spreman
+ *                                      za izvrsenje.
+ * @details     EPA objekat na koji pokazuje pokazivac se dodaje na kraj liste
+ *              spremnih EPA objekata svog prioriteta i postavlja se bit
+ *              prioriteta u bitmapi. Ukoliko neko jezgro spava, budi se.
+ */
+static PORT_C_INLINE void schedRdyInsertI_(
+    esEpa_T *       epa) {
 
-    indx = epa->prio & (~((portReg_T)0U) >> (PORT_DATA_WIDTH - PRIO_INDX_PWR));
-    indxGroup = epa->internals.prio >> PRIO_INDX_PWR;
+    ES_KERN_ASSERT(ES_KERN_USAGE_FAILURE, FALSE == schedRdyIsEpaRdy_(epa));
 
-    if (gRdyBitmap.bit[indxGroup] & ((portReg_T)1U << indx)) {
-        answer = TRUE;
-    } else {
-        answer = FALSE;
-    }
+    esDlsNodeAddTail_(
+        &EPA_RDY_BITMAP(epa)->list[epa->prio],
+        &epa->rdyList);
+    schedRdyBitSetI_(
+        EPA_RDY_BITMAP(epa),
+        epa->prio);
+#if defined(PORT_CPU_IDLE)
 
-    return (answer);
+    if (0U != gIdleCpuNum) {                                                    /* Probudi jezgra koja spavaju u kernelIdleI_().            */
+        PORT_CPU_WAKE();
+    }
 #endif
 }
 
 /**
- * @brief       Prijavljuje EPA objekat u red za cekanje.
+ * @brief       Izbacuje EPA objekat iz reda za cekanje
+ * @param       [in] epa               Pokazivac na EPA objekat koji nije
+ *                                      spreman za izvrsenje.
+ * @details     Bit prioriteta u bitmapi se brise tek kada lista spremnih EPA
+ *              objekata tog prioriteta postane prazna. Funkcija se moze
+ *              pozvati i za EPA objekat koji nije u redu za cekanje.
  */
-static PORT_C_INLINE void schedRdyRegI_(
-    const esEpa_T * epa) {
+static PORT_C_INLINE void schedRdyRmI_(
+    esEpa_T *       epa) {
 
-	ES_KERN_ASSERT(ES_KERN_USAGE_FAILURE, NULL == gRdyBitmap.list[epa->prio]);
+    esDlsNodeRm_(
+        &epa->rdyList);
+    esDlsNodeInit_(
+        &epa->rdyList);
 
-    gRdyBitmap.list[epa->prio] = (esEpa_T *)epa;
+    if (TRUE == esDlsIsEmpty_(&EPA_RDY_BITMAP(epa)->list[epa->prio])) {
+        schedRdyBitClrI_(
+            EPA_RDY_BITMAP(epa),
+            epa->prio);
+    }
 }
 
 /**
- * @brief       Odjavljuje EPA objekat iz reda za cekanje.
+ * @brief       Premesta EPA objekat na kraj liste spremnih EPA objekata
+ *              njegovog prioriteta (round-robin).
+ * @param       [in] epa               Pokazivac na EPA objekat koji je obradio
+ *                                      jedan dogadjaj.
+ * @details     Ukoliko EPA objekat nije u redu za cekanje funkcija nema efekta.
+ *              Bitmapa se ne menja posto lista ostaje neprazna.
  */
-static PORT_C_INLINE void schedRdyUnRegI_(
-    const esEpa_T * epa) {
+static PORT_C_INLINE void schedRdyRotateI_(
+    esEpa_T *       epa) {
 
-    gRdyBitmap.list[epa->prio] = (esEpa_T *)0U;
+    if (TRUE == schedRdyIsEpaRdy_(epa)) {
+        esDlsNodeRm_(
+            &epa->rdyList);
+        esDlsNodeAddTail_(
+            &EPA_RDY_BITMAP(epa)->list[epa->prio],
+            &epa->rdyList);
+    }
 }
 
+/** @} *//*-------------------------------------------------------------------*/
+/*------------------------------------------------------------------------*//**
+ * @name        Inicijalizacija i deinicijalizacija EPA objekta
+ * @{ *//*--------------------------------------------------------------------*/
+
 /**
- * @brief       Ubacuje EPA objekat u red za cekanje.
- * @param       [in] epa               Pokazivac na EPA objekat koji je spreman
- *                                      za izvrsenje.
- * @details     EPA objekat na koji pokazuje pokazivac se ubacuje u listu
- *              spremnih EPA objekata na izvrsenje.
+ * @brief       Inicijalizuje EPA objekat
+ * @param       [out] epa               Pokazivac na strukturu EPA objekta,
+ * @param       [in] stateQueue         memorija za cuvanje stanja HSM automata,
+ * @param       [in] evtQueue           memorija za cuvanje reda za cekanje,
+ * @param       [in] evtQueueLevels     velicina reda za cekanje,
+ * @param       [in] urgentQueue        memorija za cuvanje hitnog reda,
+ * @param       [in] urgentQueueLevels  velicina hitnog reda,
+ * @param       [in] deferQueue         pokazivac na bafer reda odlozenih
+ *                                      dogadjaja,
+ * @param       [in] definition         pokazivac na definicionu strukturu EPA
+ *                                      objekta.
+ * @notapi
  */
-static PORT_C_INLINE void schedRdyInsertI_(
-    const esEpa_T * epa) {
+static PORT_C_INLINE void epaInit_(
+    esEpa_T *       epa,
+    esState_T *     stateQueue,
+    esEvt_T **      evtQueue,
+    size_t          evtQueueLevels,
+    esEvt_T **      urgentQueue,
+    size_t          urgentQueueLevels,
+    struct evtDeferSlot * deferQueue,
+    const PORT_C_ROM esEpaDef_T * definition) {
 
-#if (OPT_KERNEL_EPA_PRIO_MAX <= PORT_DATA_WIDTH)
-    gRdyBitmap.bit[0] |= (portReg_T)1U << epa->prio;
-#else
-    portReg_T indxGroup;
-    portReg_T indx;
+    PORT_CRITICAL_DECL;
 
-    indx = epa->prio & (~((portReg_T)0U) >> (PORT_DATA_WIDTH - PRIO_INDX_PWR));
-    gRdyBitmap.bitGroup |= (portReg_T)1U << indxGroup;
-    gRdyBitmap.bit[indxGroup] |= (portReg_T)1U << indx;
-#endif
+    smInit(
+        (esSm_T *)epa,
+        definition->smInitState,
+        stateQueue,
+        definition->smLevels,
+        definition->smTranCache,
+        definition->smStateTable,
+        definition->smTable);
+    evtQInit(
+        &epa->evtQueue,
+        evtQueue,
+        evtQueueLevels);
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+    evtQInit(
+        &epa->evtUrgent,
+        urgentQueue,
+        urgentQueueLevels);
+#else
+    (void)urgentQueue;
+    (void)urgentQueueLevels;
+#endif
+    epa->evtDefer.slot = deferQueue;
+    epa->evtDefer.levels = (uint_fast16_t)definition->evtDeferLevels;
+    epa->evtDefer.count = 0U;
+    epa->evtDefer.status.deferred = 0U;
+    epa->evtDefer.status.recalled = 0U;
+    epa->evtDefer.status.overflow = 0U;
+    epa->evtDefer.status.saved = 0U;
+#if (0U != OPT_KERNEL_EVT_SPILL)
+    epa->evtSpill.spilled = 0U;
+    epa->evtSpill.refilled = 0U;
+    epa->evtSpill.dropped = 0U;
+    epa->evtSpill.pending = 0U;
+#endif
+    epa->prio = definition->epaPrio;
+    epa->name = definition->epaName;
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
+    {
+        uint_fast16_t word;
+
+        for (word = 0U; word < ES_EPN_SIGNAL_WORDS; word++) {
+            epa->epnSignal[word] = (portReg_T)0U;
+        }
+        epa->epnNext = (esEpa_T *)0U;
+    }
+#endif
+#if (1U < OPT_KERNEL_CPU_NUM)
+    epa->cpu = definition->epaCpu;
+    epa->isRunning = FALSE;
+#endif
+    esDlsNodeInit_(
+        &epa->rdyList);
+    ES_KERN_API_OBLIGATION(epa->signature = EPA_SIGNATURE);
+    PORT_CRITICAL_ENTER();
+    esEvtPostI(                                                                 /* Postavi dogadjaj INIT u redu cekanja ovog automata.      */
+        epa,
+        (esEvt_T *)&evtSignal[SIG_INIT]);
+    PORT_CRITICAL_EXIT();
 }
 
 /**
- * @brief       Izbacuje EPA objekat iz reda za cekanje
- * @param       [in] epa               Pokazivac na EPA objekat koji nije
- *                                      spreman za izvrsenje.
+ * @brief       DeInicijalizuje EPA objekat
+ * @param       [out] epa               Pokazivac na strukturu EPA objekta.
+ * @notapi
  */
-static PORT_C_INLINE void schedRdyRmI_(
-    const esEpa_T * epa) {
+static PORT_C_INLINE void esEpaDeInit_(
+    esEpa_T *       epa) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    schedRdyRmI_(
+        epa);
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
+
+    if (TRUE == epnIsSubscriberI_(epa)) {                                       /* Ukini sve pretplate ovog EPA objekta.                    */
+        epnUnlinkI_(
+            epa);
+    }
+#endif
+    PORT_CRITICAL_EXIT();
+#if (0U != OPT_KERNEL_EVT_SPILL)
+    epaSpillDeInit_(
+        epa);
+#endif
+
+    while (FALSE == evtQIsEmptyI_(&epa->evtQueue)) {
+        esEvt_T * evt;
+#if (1U == OPT_KERNEL_EVT_VALUE)
+        esEvtValue_T value;
+
+        evt = evtQGetValueI_(
+            &epa->evtQueue,
+            &value);
+#else
+
+        evt = evtQGetI_(
+            &epa->evtQueue);
+#endif
+        PORT_CRITICAL_ENTER();
+
+        if (TRUE == evtUsrRmIsLastI_(evt)) {                                    /* Red drzi referencu na svaki dogadjaj.                    */
+            esEvtDestroyI(
+                evt);
+        }
+        PORT_CRITICAL_EXIT();
+    }
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+
+    while (FALSE == evtQIsEmptyI_(&epa->evtUrgent)) {
+        esEvt_T * evt;
+
+        evt = evtQGetI_(
+            &epa->evtUrgent);
+        PORT_CRITICAL_ENTER();
+
+        if (TRUE == evtUsrRmIsLastI_(evt)) {
+            esEvtDestroyI(
+                evt);
+        }
+        PORT_CRITICAL_EXIT();
+    }
+#endif
+
+    while (0U != epa->evtDefer.count) {
+        esEvt_T * evt;
+
+        epa->evtDefer.count--;
+        evt = epa->evtDefer.slot[epa->evtDefer.count].evt;
+
+        if ((esEvt_T *)0U != evt) {                                             /* Dogadjaj po vrednosti nema sta da se unisti.             */
+            PORT_CRITICAL_ENTER();
+
+            if (TRUE == evtUsrRmIsLastI_(evt)) {
+                esEvtDestroyI(
+                    evt);
+            }
+            PORT_CRITICAL_EXIT();
+        }
+    }
+    evtQDeInit(
+        &epa->evtQueue);
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+    evtQDeInit(
+        &epa->evtUrgent);
+#endif
+    smDeInit(
+        &epa->sm);
+
+    ES_KERN_API_OBLIGATION(epa->signature = ~EPA_SIGNATURE);
+}
+
+#if (0U != OPT_KERNEL_EVT_SPILL)
+/** @} *//*-------------------------------------------------------------------*/
+/*------------------------------------------------------------------------*//**
+ * @name        Prelivanje dogadjaja
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Inicijalizuje zajednicki prostor za prelivanje dogadjaja
+ * @notapi
+ */
+static void spillInit(
+    void) {
+
+    uint_fast16_t cnt;
+
+    esSlsSentinelInit_(
+        &gSpillFree);
+    esSlsSentinelInit_(
+        &gSpillList);
+    gSpillTail = &gSpillList;
+
+    for (cnt = 0U; cnt < OPT_KERNEL_EVT_SPILL; cnt++) {
+        esSlsNodeAddHead_(
+            &gSpillFree,
+            &gSpill[cnt].list);
+    }
+}
+
+/**
+ * @brief       Preliva dogadjaj EPA objekta u zajednicki prostor
+ * @param       epa                    Pokazivac na EPA objekat,
+ * @param       evt                    dogadjaj ili kodiran identifikator
+ *                                      dogadjaja po vrednosti,
+ * @param       value                  vrednost dogadjaja po vrednosti,
+ * @param       isAhead                da li se dogadjaj postavlja ispred
+ *                                      ostalih prelivenih dogadjaja ovog EPA
+ *                                      objekta.
+ * @return      Da li je dogadjaj preliven
+ *  @retval     TRUE - dogadjaj je preliven,
+ *  @retval     FALSE - nema slobodne lokacije, dogadjaj nije preliven.
+ * @details     Brojac korisnika dogadjaja se ne menja, to je obaveza
+ *              pozivaoca. Poziva se unutar kriticne sekcije.
+ * @notapi
+ */
+static bool_T epaSpillPutI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt,
+    uintptr_t       value,
+    bool_T          isAhead) {
+
+    struct evtSpill * spill;
+    esSlsList_T * prev;
+    bool_T answer;
+
+    answer = FALSE;
+
+    if (&gSpillFree != gSpillFree.next) {
+        spill = (struct evtSpill *)gSpillFree.next;
+        esSlsNodeRmAfter_(
+            &gSpillFree);
+        spill->epa = epa;
+        spill->evt = evt;
+#if (1U == OPT_KERNEL_EVT_VALUE)
+        spill->value = value;
+#else
+        (void)value;
+#endif
+        prev = gSpillTail;
+
+        if (TRUE == isAhead) {                                                  /* Trazi se clan ispred prvog dogadjaja ovog EPA objekta.   */
+            esSlsList_T * curr;
+
+            curr = &gSpillList;
+
+            while ((&gSpillList != curr->next) &&
+                   (epa != ((struct evtSpill *)curr->next)->epa)) {
+                curr = curr->next;
+            }
+
+            if (&gSpillList != curr->next) {
+                prev = curr;
+            }
+        }
+        esSlsNodeAddAfter_(
+            prev,
+            &spill->list);
+
+        if (gSpillTail == prev) {
+            gSpillTail = &spill->list;
+        }
+        epa->evtSpill.pending++;
+        epa->evtSpill.spilled++;
+        answer = TRUE;
+    } else {
+        epa->evtSpill.dropped++;
+    }
+
+    return (answer);
+}
+
+/**
+ * @brief       Vraca prelivene dogadjaje EPA objekta u red cekanja
+ * @param       epa                    Pokazivac na EPA objekat
+ * @details     Dogadjaji se vracaju redom kojim su preliveni, sve dok u redu
+ *              cekanja ima mesta za sledeci dogadjaj. Poziva se unutar
+ *              kriticne sekcije.
+ * @notapi
+ */
+static void epaSpillRefillI_(
+    esEpa_T *       epa) {
+
+    esSlsList_T * prev;
+    bool_T isPending;
+
+    prev = &gSpillList;
+    isPending = TRUE;
+
+    while ((0U != epa->evtSpill.pending) && (TRUE == isPending)) {
+        struct evtSpill * spill;
+
+        spill = (struct evtSpill *)prev->next;
+
+        if (epa != spill->epa) {
+            prev = prev->next;
+#if (1U == OPT_KERNEL_EVT_VALUE)
+        } else if (EVTQ_IS_VALUE(spill->evt)) {
+
+            if (TRUE == evtQHasValueRoomI_(&epa->evtQueue)) {
+                evtQPutI_(                                                      /* Identifikator je vec kodiran.                            */
+                    &epa->evtQueue,
+                    spill->evt);
+                evtQPutI_(
+                    &epa->evtQueue,
+                    (esEvt_T *)spill->value);
+            } else {
+                isPending = FALSE;
+            }
+#endif
+        } else if (FALSE == evtQIsFullI_(&epa->evtQueue)) {
+            evtQPutI_(
+                &epa->evtQueue,
+                spill->evt);
+        } else {
+            isPending = FALSE;
+        }
+
+        if ((TRUE == isPending) && (epa == spill->epa)) {                       /* Dogadjaj je vracen, lokacija se oslobadja.               */
+            esSlsNodeRmAfter_(
+                prev);
+
+            if (gSpillTail == &spill->list) {
+                gSpillTail = prev;
+            }
+            esSlsNodeAddHead_(
+                &gSpillFree,
+                &spill->list);
+            epa->evtSpill.pending--;
+            epa->evtSpill.refilled++;
+        }
+    }
+}
+
+/**
+ * @brief       Zamenjuje preliven dogadjaj dogadjajem istog identifikatora
+ * @param       epa                    Pokazivac na EPA objekat
+ * @param       evt                    Nov dogadjaj.
+ * @return      Dogadjaj koji je zamenjen ili NULL ukoliko EPA objekat nema
+ *              preliven dogadjaj sa identifikatorom <code>evt->id</code>.
+ * @details     Menja se dogadjaj koji je najduze preliven. Dogadjaji po
+ *              vrednosti se preskacu. Poziva se unutar kriticne sekcije.
+ * @notapi
+ */
+static esEvt_T * epaSpillReplaceI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    esSlsList_T * curr;
+    esEvt_T * old;
+
+    old = (esEvt_T *)0U;
+    curr = gSpillList.next;
+
+    while ((&gSpillList != curr) && ((esEvt_T *)0U == old)) {
+        struct evtSpill * spill;
+
+        spill = (struct evtSpill *)curr;
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+        if ((epa == spill->epa) && (!EVTQ_IS_VALUE(spill->evt)) && (evt->id == spill->evt->id)) {
+#else
+        if ((epa == spill->epa) && (evt->id == spill->evt->id)) {
+#endif
+            old = spill->evt;
+            spill->evt = evt;
+        }
+        curr = curr->next;
+    }
+
+    return (old);
+}
+
+/**
+ * @brief       Unistava sve prelivene dogadjaje EPA objekta
+ * @param       epa                    Pokazivac na EPA objekat
+ * @notapi
+ */
+static void epaSpillDeInit_(
+    esEpa_T *       epa) {
+
+    PORT_CRITICAL_DECL;
+    esSlsList_T * prev;
+
+    PORT_CRITICAL_ENTER();
+    prev = &gSpillList;
+
+    while (0U != epa->evtSpill.pending) {
+        struct evtSpill * spill;
+
+        spill = (struct evtSpill *)prev->next;
+
+        if (epa == spill->epa) {
+            esSlsNodeRmAfter_(
+                prev);
+
+            if (gSpillTail == &spill->list) {
+                gSpillTail = prev;
+            }
+#if (1U == OPT_KERNEL_EVT_VALUE)
+
+            if ((!EVTQ_IS_VALUE(spill->evt)) && (TRUE == evtUsrRmIsLastI_(spill->evt))) {
+                esEvtDestroyI(
+                    spill->evt);
+            }
+#else
+
+            if (TRUE == evtUsrRmIsLastI_(spill->evt)) {
+                esEvtDestroyI(
+                    spill->evt);
+            }
+#endif
+            esSlsNodeAddHead_(
+                &gSpillFree,
+                &spill->list);
+            epa->evtSpill.pending--;
+        } else {
+            prev = prev->next;
+        }
+    }
+    PORT_CRITICAL_EXIT();
+}
+#endif
+
+/** @} *//*-------------------------------------------------------------------*/
+/*------------------------------------------------------------------------*//**
+ * @name        Ostale lokalne funkcije
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**
+ * @brief       Dobavlja grupu dogadjaja iz reda za cekanje EPA objekta
+ * @param       epa                    Pokazivac na EPA objekat,
+ * @param       evtBuff                bafer za najvise
+ *                                      @ref OPT_KERNEL_DISPATCH_BATCH
+ *                                      pokazivaca na dogadjaje,
+ * @param       valueBuff              bafer iste velicine u koji se smestaju
+ *                                      dogadjaji po vrednosti, postoji samo
+ *                                      kada je @ref OPT_KERNEL_EVT_VALUE
+ *                                      ukljucena.
+ * @return      Broj dogadjaja koji su smesteni u @c evtBuff. Nula znaci da je
+ *              red bio prazan i da je EPA objekat samo uklonjen iz reda
+ *              spremnih EPA objekata.
+ * @details     Dogadjaji se uzimaju iz reda dok se red ne isprazni ili dok se
+ *              ne dobavi @ref OPT_KERNEL_DISPATCH_BATCH dogadjaja. Kada je
+ *              opcija @ref OPT_KERNEL_EVTQ_URGENT ukljucena prvo se prazni
+ *              hitan red.
+ *
+ *              Dobavljeni dogadjaji zadrzavaju referencu reda. Dispecer je
+ *              otpusta tek nakon obrade, jer bi u SMP rezimu drugo jezgro
+ *              koje obradjuje isti objavljeni dogadjaj moglo da ga unisti dok
+ *              se on jos obradjuje.
+ *
+ *              Svaki dogadjaj koji ceka u redu odlozenih dogadjaja bi se, da
+ *              je ponovo poslat, obradio jos jednom uz svaki dobavljen
+ *              dogadjaj. Ta procena se dodaje u statistiku @c saved.
+ *
+ *              U SMP rezimu EPA objekat se uvek uklanja iz bitmape spremnih
+ *              EPA objekata i oznacava kao aktivan, tako da ga ni jedno drugo
+ *              jezgro ne moze preuzeti dok se dogadjaj obradjuje. EPA objekat
+ *              se ponovo ubacuje u bitmapu pozivom epaReleaseI_().
+ * @notapi
+ */
+#if (1U == OPT_KERNEL_EVT_VALUE)
+uint_fast8_t evtFetchI(
+    esEpa_T *       epa,
+    esEvt_T **      evtBuff,
+    esEvtValue_T *  valueBuff) {
+#else
+uint_fast8_t evtFetchI(
+    esEpa_T *       epa,
+    esEvt_T **      evtBuff) {
+#endif
+
+    uint_fast8_t nEvt;
+
+    nEvt = 0U;
+
+    while ((OPT_KERNEL_DISPATCH_BATCH > nEvt) &&
+           (FALSE == epaEvtQIsEmptyI_(epa))) {
+        esEvt_T * evt;
+
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+        if (FALSE == evtQIsEmptyI_(&epa->evtUrgent)) {
+            evt = evtQGetI_(
+                &epa->evtUrgent);
+        } else {
+# if (1U == OPT_KERNEL_EVT_VALUE)
+            evt = evtQGetValueI_(
+                &epa->evtQueue,
+                &valueBuff[nEvt]);
+# else
+            evt = evtQGetI_(
+                &epa->evtQueue);
+# endif
+        }
+#elif (1U == OPT_KERNEL_EVT_VALUE)
+        evt = evtQGetValueI_(
+            &epa->evtQueue,
+            &valueBuff[nEvt]);
+#else
+        evt = evtQGetI_(
+            &epa->evtQueue);
+#endif
+        evtBuff[nEvt] = evt;
+        nEvt++;
+    }
+#if (0U != OPT_KERNEL_EVT_SPILL)
+
+    if (0U != epa->evtSpill.pending) {
+        epaSpillRefillI_(
+            epa);
+    }
+#endif
+    epa->evtDefer.status.saved += (uint32_t)nEvt * epa->evtDefer.count;
+#if defined(PORT_WAIT_UNTIL)
+
+    if (0U != gPostWaitNum) {                                                   /* U redu je oslobodjeno mesto, probudi proizvodjace.       */
+        PORT_WAIT_WAKE();
+    }
+#endif
+
+#if (1U < OPT_KERNEL_CPU_NUM)
+    epa->isRunning = TRUE;
+    schedRdyRmI_(
+        epa);
+#else
+    if (TRUE == epaEvtQIsEmptyI_(epa)) {
+        schedRdyRmI_(
+            epa);
+    }
+#endif
+
+    return (nEvt);
+}
+
+/**
+ * @brief       Oslobadja EPA objekat nakon obrade dogadjaja
+ * @param       epa                    Pokazivac na EPA objekat
+ * @details     U SMP rezimu EPA objekat se vraca na kraj reda spremnih EPA
+ *              objekata svog jezgra ukoliko u redu cekanja postoje novi
+ *              dogadjaji. U rezimu sa jednim jezgrom EPA objekat koji je i
+ *              dalje spreman se premesta na kraj reda svog prioriteta.
+ * @notapi
+ */
+static PORT_C_INLINE void epaReleaseI_(
+    esEpa_T *       epa) {
 
-#if (OPT_KERNEL_EPA_PRIO_MAX <= PORT_DATA_WIDTH)
-    gRdyBitmap.bit[0] &= ~((portReg_T)1U << epa->prio);
+#if (1U < OPT_KERNEL_CPU_NUM)
+    epa->isRunning = FALSE;
+
+    if (FALSE == epaEvtQIsEmptyI_(epa)) {
+        schedRdyInsertI_(
+            epa);
+    }
 #else
-    portReg_T indxGroup;
-    portReg_T indx;
+    schedRdyRotateI_(
+        epa);
+#endif
+}
+
+/**
+ * @brief       Ispituje da li EPA objekat treba ubaciti u bitmapu spremnih
+ *              EPA objekata prilikom slanja dogadjaja.
+ * @param       epa                    Pokazivac na EPA objekat
+ * @return      TRUE ukoliko je red cekanja prazan i EPA objekat se ne
+ *              izvrsava na nekom jezgru.
+ * @notapi
+ */
+static PORT_C_INLINE bool_T epaIsIdleI_(
+    esEpa_T *       epa) {
+
+    bool_T answer;
+
+    answer = epaEvtQIsEmptyI_(
+        epa);
+#if (1U < OPT_KERNEL_CPU_NUM)
+
+    if (TRUE == epa->isRunning) {
+        answer = FALSE;
+    }
+#endif
+
+    return (answer);
+}
+
+/**
+ * @brief       Ispituje da li su svi redovi cekanja EPA objekta prazni
+ * @param       epa                    Pokazivac na EPA objekat
+ * @return      TRUE ukoliko nema dogadjaja ni u jednom redu cekanja.
+ * @notapi
+ */
+static PORT_C_INLINE bool_T epaEvtQIsEmptyI_(
+    esEpa_T *       epa) {
+
+    bool_T answer;
+
+    answer = evtQIsEmptyI_(
+        &epa->evtQueue);
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+
+    if (FALSE == evtQIsEmptyI_(&epa->evtUrgent)) {
+        answer = FALSE;
+    }
+#endif
+
+    return (answer);
+}
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+/**
+ * @brief       Ubacuje EPA objekat u red spremnih EPA objekata nakon sto je
+ *              njegov red cekanja postao neprazan.
+ * @param       epa                    Pokazivac na EPA objekat
+ * @details     Poziva se unutar kriticne sekcije. Proizvodjac koji je red
+ *              povecao sa nule ne zna da li je dispecer u medjuvremenu vec
+ *              ubacio EPA objekat, pa se stanje ponovo proverava. Dispecer je
+ *              mozda vec i ispraznio red, pre nego sto je proizvodjac usao u
+ *              kriticnu sekciju, pa se EPA objekat sa praznim redom ne ubacuje.
+ * @notapi
+ */
+static PORT_C_INLINE void epaWakeI_(
+    esEpa_T *       epa) {
+
+    if ((FALSE == schedRdyIsEpaRdy_(epa)) &&
+        (FALSE == epaEvtQIsEmptyI_(epa))) {
+# if (1U < OPT_KERNEL_CPU_NUM)
+
+        if (FALSE == epa->isRunning) {
+            schedRdyInsertI_(
+                epa);
+        }
+# else
+        schedRdyInsertI_(
+            epa);
+# endif
+    }
+}
+
+/**
+ * @brief       Salje dogadjaj preko lock-free reda za cekanje
+ * @param       epa                    Pokazivac na EPA objekat,
+ * @param       evtQ                   red cekanja EPA objekta u koji se
+ *                                      dogadjaj upisuje,
+ * @param       evt                    dogadjaj koji se salje.
+ * @details     Upis u red se vrsi bez kriticne sekcije. U kriticnu sekciju se
+ *              ulazi samo kada je red bio prazan i EPA objekat treba ubaciti
+ *              u red spremnih EPA objekata, ili kada je red pun i dogadjaj
+ *              treba unistiti.
+ * @notapi
+ */
+static void evtPostLf(
+    esEpa_T *       epa,
+    evtQueue_T *    evtQ,
+    esEvt_T *       evt) {
+
+    PORT_CRITICAL_DECL;
+    bool_T wasEmpty;
+
+    evtUsrAddI_(
+        evt);
+
+    if (TRUE == evtQPut_(evtQ, evt, &wasEmpty)) {
+
+        if (TRUE == wasEmpty) {
+            PORT_CRITICAL_ENTER();
+            epaWakeI_(
+                epa);
+            PORT_CRITICAL_EXIT();
+        }
+    } else {
+        /* Greska! Red je pun. */
+        ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
+
+        PORT_CRITICAL_ENTER();
+
+        if (TRUE == evtUsrRmIsLastI_(evt)) {
+            esEvtDestroyI(
+                evt);
+        }
+        PORT_CRITICAL_EXIT();
+    }
+}
+#endif
+
+/**
+ * @brief       Postavlja dogadjaj u red cekanja EPA objekta
+ * @param       epa                    Pokazivac na EPA objekat,
+ * @param       evt                    dogadjaj koji se postavlja.
+ * @return      Da li je dogadjaj postavljen u red
+ *  @retval     TRUE - dogadjaj je u redu i EPA objekat je spreman,
+ *  @retval     FALSE - red je pun, dogadjaj nije postavljen.
+ * @details     Brojac korisnika dogadjaja se ne menja, to je obaveza
+ *              pozivaoca. Poziva se unutar kriticne sekcije.
+ * @notapi
+ */
+static PORT_C_INLINE bool_T epaEvtPutI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    bool_T answer;
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    bool_T wasEmpty;
+
+    answer = evtQPut_(
+        &epa->evtQueue,
+        evt,
+        &wasEmpty);
+
+    if ((TRUE == answer) && (TRUE == wasEmpty)) {
+        epaWakeI_(
+            epa);
+    }
+#else
+    answer = TRUE;
+
+    if (TRUE == epaIsIdleI_(epa)) {
+        schedRdyInsertI_(
+            epa);
+        evtQPutI_(
+            &epa->evtQueue,
+            evt);
+# if (0U != OPT_KERNEL_EVT_SPILL)
+    } else if ((0U == epa->evtSpill.pending) &&
+               (FALSE == evtQIsFullI_(&epa->evtQueue))) {
+        evtQPutI_(
+            &epa->evtQueue,
+            evt);
+    } else {
+        answer = epaSpillPutI_(
+            epa,
+            evt,
+            0U,
+            FALSE);
+    }
+# else
+    } else if (FALSE == evtQIsFullI_(&epa->evtQueue)) {
+        evtQPutI_(
+            &epa->evtQueue,
+            evt);
+    } else {
+        answer = FALSE;
+    }
+# endif
+#endif
+
+    return (answer);
+}
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+/**
+ * @brief       Postavlja dogadjaj po vrednosti u red cekanja EPA objekta
+ * @param       epa                    Pokazivac na EPA objekat,
+ * @param       id                     identifikator dogadjaja,
+ * @param       value                  vrednost dogadjaja.
+ * @return      Da li je dogadjaj postavljen u red
+ *  @retval     TRUE - dogadjaj je u redu i EPA objekat je spreman,
+ *  @retval     FALSE - u redu nema mesta, dogadjaj nije postavljen.
+ * @details     Poziva se unutar kriticne sekcije.
+ * @notapi
+ */
+static PORT_C_INLINE bool_T epaValuePutI_(
+    esEpa_T *       epa,
+    esEvtId_T       id,
+    uintptr_t       value) {
+
+    bool_T answer;
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    bool_T wasEmpty;
+
+    answer = evtQPutValue_(
+        &epa->evtQueue,
+        id,
+        value,
+        &wasEmpty);
+
+    if ((TRUE == answer) && (TRUE == wasEmpty)) {
+        epaWakeI_(
+            epa);
+    }
+#else
+    answer = FALSE;
+
+# if (0U != OPT_KERNEL_EVT_SPILL)
+    if ((0U == epa->evtSpill.pending) &&
+        (TRUE == evtQHasValueRoomI_(&epa->evtQueue))) {
+# else
+    if (TRUE == evtQHasValueRoomI_(&epa->evtQueue)) {
+# endif
+
+        if (TRUE == epaIsIdleI_(epa)) {
+            schedRdyInsertI_(
+                epa);
+        }
+        evtQPutValueI_(
+            &epa->evtQueue,
+            id,
+            value);
+        answer = TRUE;
+    }
+# if (0U != OPT_KERNEL_EVT_SPILL)
+    else {
+        answer = epaSpillPutI_(
+            epa,
+            EVTQ_VALUE_ENCODE(id),
+            value,
+            FALSE);
+    }
+# endif
+#endif
+
+    return (answer);
+}
+#endif
+
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
+/**
+ * @brief       Ispituje da li je EPA objekat pretplacen na barem jedan signal
+ * @param       epa                    Pokazivac na EPA objekat
+ * @notapi
+ */
+static bool_T epnIsSubscriberI_(
+    const esEpa_T * epa) {
+
+    uint_fast16_t word;
+    bool_T answer;
+
+    answer = FALSE;
+
+    for (word = 0U; word < ES_EPN_SIGNAL_WORDS; word++) {
+
+        if ((portReg_T)0U != epa->epnSignal[word]) {
+            answer = TRUE;
+
+            break;
+        }
+    }
+
+    return (answer);
+}
+
+/**
+ * @brief       Ponovo izracunava bit prioriteta @c prio u bitmapi signala
+ *              @c id
+ * @param       prio                   Prioritet pretplatnika,
+ * @param       id                     signal.
+ * @details     Bit ostaje postavljen dok je barem jedan EPA objekat tog
+ *              prioriteta pretplacen na signal. Poziva se unutar kriticne
+ *              sekcije, van brze putanje objavljivanja.
+ * @notapi
+ */
+static void epnPrioUpdateI_(
+    uint_fast16_t   prio,
+    esEvtId_T       id) {
+
+    portReg_T * word;
+    const esEpa_T * epa;
+
+    word = &gEpnSubscr[id][prio >> PRIO_INDX_PWR];
+    *word &= ~EPN_PRIO_BIT(prio);
+    epa = gEpnEpa[prio];
+
+    while ((esEpa_T *)0U != epa) {
+
+        if (EPN_IS_SIGNAL(epa, id)) {
+            *word |= EPN_PRIO_BIT(prio);
+
+            break;
+        }
+        epa = epa->epnNext;
+    }
+}
+
+/**
+ * @brief       Ubacuje EPA objekat u listu pretplatnika njegovog prioriteta
+ * @param       epa                    Pokazivac na EPA objekat koji ima barem
+ *                                      jednu pretplatu.
+ * @details     Postavlja bit prioriteta u bitmapama svih signala na koje je
+ *              EPA objekat pretplacen.
+ * @notapi
+ */
+static void epnLinkI_(
+    esEpa_T *       epa) {
+
+    esEvtId_T id;
+
+    epa->epnNext = gEpnEpa[epa->prio];
+    gEpnEpa[epa->prio] = epa;
+
+    for (id = 0U; id < OPT_KERNEL_EPN_SIGNAL_MAX; id++) {
+
+        if (EPN_IS_SIGNAL(epa, id)) {
+            gEpnSubscr[id][epa->prio >> PRIO_INDX_PWR] |= EPN_PRIO_BIT(epa->prio);
+        }
+    }
+}
+
+/**
+ * @brief       Izbacuje EPA objekat iz liste pretplatnika njegovog prioriteta
+ * @param       epa                    Pokazivac na EPA objekat koji je u
+ *                                      listi.
+ * @details     Pretplate EPA objekta ostaju zapamcene, a biti prioriteta se
+ *              brisu samo za signale na koje vise nije pretplacen ni jedan
+ *              drugi EPA objekat istog prioriteta.
+ * @notapi
+ */
+static void epnUnlinkI_(
+    esEpa_T *       epa) {
+
+    esEpa_T ** link;
+    esEvtId_T id;
+
+    link = &gEpnEpa[epa->prio];
+
+    while (epa != *link) {
+        link = &(*link)->epnNext;
+    }
+    *link = epa->epnNext;
+    epa->epnNext = (esEpa_T *)0U;
+
+    for (id = 0U; id < OPT_KERNEL_EPN_SIGNAL_MAX; id++) {
+
+        if (EPN_IS_SIGNAL(epa, id)) {
+            epnPrioUpdateI_(
+                epa->prio,
+                id);
+        }
+    }
+}
+#endif
+
+/**
+ * @brief       Smesta dogadjaj u red odlozenih dogadjaja EPA objekta
+ * @param       epa                    Pokazivac na EPA objekat,
+ * @param       evt                    dogadjaj za koji je funkcija stanja
+ *                                      vratila RETN_DEFERRED.
+ * @details     Kada je red odlozenih dogadjaja pun, ili ne postoji, dogadjaj
+ *              se ponovo salje na kraj reda cekanja. Poziva se unutar
+ *              kriticne sekcije.
+ * @notapi
+ */
+static void epaDeferI_(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    if (epa->evtDefer.levels > epa->evtDefer.count) {
+        struct evtDeferSlot * slot;
+
+        slot = &epa->evtDefer.slot[epa->evtDefer.count];
+#if (1U == OPT_KERNEL_EVT_VALUE)
+
+        if (ES_EVT_IS_VALUE(evt)) {                                             /* Struktura je na steku dispecera, cuva se samo sadrzaj.   */
+            slot->evt = (esEvt_T *)0U;
+            slot->id = evt->id;
+            slot->value = ES_EVT_VALUE_GET(evt);
+        } else {
+            evtUsrAddI_(
+                evt);
+            slot->evt = evt;
+        }
+#else
+        evtUsrAddI_(
+            evt);
+        slot->evt = evt;
+#endif
+        epa->evtDefer.count++;
+        epa->evtDefer.status.deferred++;
+    } else {
+        epa->evtDefer.status.overflow++;
+#if (1U == OPT_KERNEL_EVT_VALUE)
+
+        if (ES_EVT_IS_VALUE(evt)) {                                             /* Struktura na steku se ponovo kodira u red.               */
+            esEvtPostValueI(
+                epa,
+                evt->id,
+                ES_EVT_VALUE_GET(evt));
+        } else {
+            esEvtPostI(
+                epa,
+                evt);
+        }
+#else
+        esEvtPostI(
+            epa,
+            evt);
+#endif
+    }
+}
+
+/**
+ * @brief       Dispecer dogadjaja jednog jezgra
+ * @param       cpu                    Identifikator jezgra koje izvrsava
+ *                                      dispecer.
+ * @details     Iz reda izabranog EPA objekta se u jednoj kriticnoj sekciji
+ *              uzima do @ref OPT_KERNEL_DISPATCH_BATCH dogadjaja koji se
+ *              zatim obradjuju jedan za drugim van kriticne sekcije. Nakon
+ *              obrade grupe, reference reda se otpustaju u jednoj kriticnoj
+ *              sekciji, dogadjaj unistava samo onaj ko je otpustio poslednju
+ *              referencu, i ponovo se bira EPA objekat sa najvecim prioritetom,
+ *              tako da EPA objekat viseg prioriteta ceka najvise jednu grupu.
+ *
+ *              Funkcija se nikada ne vraca.
+ * @notapi
+ */
+static void kernelDispatch(
+    uint_fast8_t    cpu) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+
+    while (TRUE) {
+        esEpa_T * epa;
+
+        epa = schedRdyNextI_(
+            cpu);
+
+        while ((esEpa_T *)0U != epa) {
+            esEvt_T * evt[OPT_KERNEL_DISPATCH_BATCH];
+            uint_fast8_t nEvt;
+            uint_fast8_t cnt;
+#if (1U == OPT_KERNEL_EVT_VALUE)
+            esEvtValue_T value[OPT_KERNEL_DISPATCH_BATCH];
+
+            gCurrentEpa[cpu] = epa;
+            nEvt = evtFetchI(
+                epa,
+                evt,
+                value);
+#else
+
+            gCurrentEpa[cpu] = epa;
+            nEvt = evtFetchI(
+                epa,
+                evt);
+#endif
+            PORT_CRITICAL_EXIT();
+
+            for (cnt = 0U; cnt < nEvt; cnt++) {
+                esStatus_T status;
+
+                status = SM_DISPATCH(
+                    (esSm_T *)epa,
+                    evt[cnt]);
+
+                if (RETN_DEFERRED == status) {                                  /* Odlozi odmah, kako bi ga esEvtRecall() u nekom od        */
+                    PORT_CRITICAL_ENTER();                                      /* sledecih dogadjaja grupe pronasao.                       */
+                    epaDeferI_(
+                        epa,
+                        evt[cnt]);
+                    PORT_CRITICAL_EXIT();
+                }
+            }
+            PORT_CRITICAL_ENTER();
+
+            for (cnt = 0U; cnt < nEvt; cnt++) {
+
+                if (TRUE == evtUsrRmIsLastI_(evt[cnt])) {                       /* Svako mesto otpusta samo svoju referencu, pa se          */
+                    esEvtDestroyI(                                              /* dogadjaj koji je vise puta u grupi unistava jednom.      */
+                        evt[cnt]);
+                }
+            }
+            epaReleaseI_(
+                epa);
+            epa = schedRdyNextI_(
+                cpu);
+        }
+        gCurrentEpa[cpu] = (esEpa_T *)0U;
+#if defined(PORT_CPU_IDLE)
+        kernelIdleI_();
+#else
+        PORT_CRITICAL_EXIT();
+# if defined(PORT_CPU_RELAX)
+        PORT_CPU_RELAX();
+# endif
+        PORT_CRITICAL_ENTER();
+#endif
+    }
+}
+
+/**
+ * @brief       Besposleno stanje jezgra
+ * @details     Poziva se iz kriticne sekcije dispecera kada jezgro nema
+ *              spreman EPA objekat. Ukoliko port podrzava spavanje
+ *              (PORT_CPU_IDLE()) jezgro spava dok ga ne probudi slanje
+ *              dogadjaja, umesto da neprekidno proverava bitmapu. Kada su sva
+ *              jezgra besposlena zaustavljaju se i periodicni sistemski tikovi
+ *              do isteka prvog vremenskog dogadjaja.
+ * @notapi
+ */
+#if defined(PORT_CPU_IDLE)
+static PORT_C_INLINE void kernelIdleI_(
+    void) {
+
+    gIdleCpuNum++;
+# if (1U == OPT_TEM_ENABLE)
+
+    if (OPT_KERNEL_CPU_NUM == gIdleCpuNum) {
+        temSuppressI();
+    }
+# endif
+    PORT_CPU_IDLE();                                                            /* Port izlazi iz kriticne sekcije dok jezgro spava.        */
+# if (1U == OPT_TEM_ENABLE)
+    temResumeI();
+# endif
+    gIdleCpuNum--;
+}
+#endif
+
+/** @} *//*-------------------------------------------------------------------*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+/*----------------------------------------------------------------------------*/
+void esEvtPost(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+
+    evtPostLf(
+        epa,
+        &epa->evtQueue,
+        evt);
+#else
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    esEvtPostI(
+       epa,
+       evt);
+    PORT_CRITICAL_EXIT();
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+void esEvtPostI(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    evtPostLf(
+        epa,
+        &epa->evtQueue,
+        evt);
+#else
+    if (TRUE == epaEvtPutI_(epa, evt)) {
+        evtUsrAddI_(
+            evt);
+    } else {
+        /* Greska! Red je pun. */
+    	ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
+
+        esEvtDestroyI(
+            evt);
+    }
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+esEvtPostStatus_T esEvtTryPost(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    esEvtPostStatus_T status;
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    PORT_CRITICAL_DECL;
+    bool_T wasEmpty;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+
+    evtUsrAddI_(
+        evt);
+
+    if (TRUE == evtQPut_(&epa->evtQueue, evt, &wasEmpty)) {
+
+        if (TRUE == wasEmpty) {
+            PORT_CRITICAL_ENTER();
+            epaWakeI_(
+                epa);
+            PORT_CRITICAL_EXIT();
+        }
+        status = EVT_POST_OK;
+    } else {
+        evtUsrRmI_(                                                             /* Dogadjaj ostaje pozivaocu.                               */
+            evt);
+        status = EVT_POST_FULL;
+    }
+#else
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    status = esEvtTryPostI(
+        epa,
+        evt);
+    PORT_CRITICAL_EXIT();
+#endif
+
+    return (status);
+}
+
+/*----------------------------------------------------------------------------*/
+esEvtPostStatus_T esEvtTryPostI(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    esEvtPostStatus_T status;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+
+    if (TRUE == epaEvtPutI_(epa, evt)) {
+        evtUsrAddI_(
+            evt);
+        status = EVT_POST_OK;
+    } else {
+        status = EVT_POST_FULL;
+    }
+
+    return (status);
+}
+
+#if defined(PORT_WAIT_UNTIL)
+/*----------------------------------------------------------------------------*/
+esEvtPostStatus_T esEvtPostTimed(
+    esEpa_T *       epa,
+    esEvt_T *       evt,
+    uint32_t        timeout) {
+
+    PORT_CRITICAL_DECL;
+    esEvtPostStatus_T status;
+    uint64_t deadline;
+
+    deadline = PORT_WAIT_DEADLINE(
+        timeout);
+    PORT_CRITICAL_ENTER();
+    status = esEvtTryPostI(
+        epa,
+        evt);
+
+    if (EVT_POST_FULL == status) {
+        uint_fast8_t isExpired;
+
+        gPostWaitNum++;
+
+        do {
+            isExpired = PORT_WAIT_UNTIL(                                        /* Port izlazi iz kriticne sekcije dok nit spava.           */
+                deadline);
+            status = esEvtTryPostI(
+                epa,
+                evt);
+        } while ((EVT_POST_FULL == status) && (0U == isExpired));
+        gPostWaitNum--;
+
+        if (EVT_POST_FULL == status) {
+            status = EVT_POST_TIMEOUT;
+        }
+    }
+    PORT_CRITICAL_EXIT();
+
+    return (status);
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+void esEvtPostAhead(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    esEvtPostAheadI(
+        epa,
+        evt);
+    PORT_CRITICAL_EXIT();
+}
+
+/*----------------------------------------------------------------------------*/
+void esEvtPostAheadI(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+
+#if (1U == OPT_KERNEL_EVTQ_URGENT) && (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    evtPostLf(
+        epa,
+        &epa->evtUrgent,
+        evt);
+#elif (1U == OPT_KERNEL_EVTQ_URGENT)
+    if (FALSE == evtQIsFullI_(&epa->evtUrgent)) {
+
+        if (TRUE == epaIsIdleI_(epa)) {
+            schedRdyInsertI_(
+                epa);
+        }
+        evtQPutI_(
+            &epa->evtUrgent,
+            evt);
+        evtUsrAddI_(
+            evt);
+    } else {
+        /* Greska! Hitan red je pun. */
+        ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
+
+        esEvtDestroyI(
+            evt);
+    }
+#elif (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    evtPostLf(                                                                  /* Lock-free red ne podrzava upis na pocetak.               */
+        epa,
+        &epa->evtQueue,
+        evt);
+#else
+    if (TRUE == epaIsIdleI_(epa)) {
+        schedRdyInsertI_(
+            epa);
+        evtQPutAheadI_(
+            &epa->evtQueue,
+            evt);
+        evtUsrAddI_(
+            evt);
+    } else if (FALSE == evtQIsFullI_(&epa->evtQueue)) {
+        evtQPutAheadI_(
+            &epa->evtQueue,
+            evt);
+        evtUsrAddI_(
+            evt);
+# if (0U != OPT_KERNEL_EVT_SPILL)
+    } else if (TRUE == epaSpillPutI_(epa, evt, 0U, TRUE)) {                     /* Ispred ostalih prelivenih dogadjaja ovog EPA objekta.    */
+        evtUsrAddI_(
+            evt);
+# endif
+    } else {
+        /* Greska! Red je pun. */
+        ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
+
+        esEvtDestroyI(
+            evt);
+    }
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+void esEvtPostCoalesce(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    esEvtPostCoalesceI(
+        epa,
+        evt);
+    PORT_CRITICAL_EXIT();
+}
+
+/*----------------------------------------------------------------------------*/
+void esEvtPostCoalesceI(
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    esEvt_T * old;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+    old = evtQReplaceI(
+        &epa->evtUrgent,
+        evt);
+
+    if ((esEvt_T *)0U == old) {
+        old = evtQReplaceI(
+            &epa->evtQueue,
+            evt);
+    }
+#else
+    old = evtQReplaceI(
+        &epa->evtQueue,
+        evt);
+#endif
+#if (0U != OPT_KERNEL_EVT_SPILL)
+
+    if ((esEvt_T *)0U == old) {
+        old = epaSpillReplaceI_(
+            epa,
+            evt);
+    }
+#endif
+
+    if ((esEvt_T *)0U != old) {                                                 /* Dogadjaj je zauzeo mesto starog, EPA objekat je vec      */
+        evtUsrAddI_(                                                            /* spreman.                                                 */
+            evt);
+
+        if (TRUE == evtUsrRmIsLastI_(old)) {
+            esEvtDestroyI(
+                old);
+        }
+    } else {
+        esEvtPostI(
+            epa,
+            evt);
+    }
+}
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+/*----------------------------------------------------------------------------*/
+void esEvtPostValue(
+    esEpa_T *       epa,
+    esEvtId_T       id,
+    uintptr_t       value) {
+
+    PORT_CRITICAL_DECL;
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    bool_T wasEmpty;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, (UINTPTR_MAX >> 1U) >= (uintptr_t)id);
+
+    if (TRUE == evtQPutValue_(&epa->evtQueue, id, value, &wasEmpty)) {
+
+        if (TRUE == wasEmpty) {
+            PORT_CRITICAL_ENTER();
+            epaWakeI_(
+                epa);
+            PORT_CRITICAL_EXIT();
+        }
+    } else {
+        /* Greska! Red je pun. */
+        ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
+    }
+#else
+    PORT_CRITICAL_ENTER();
+    esEvtPostValueI(
+        epa,
+        id,
+        value);
+    PORT_CRITICAL_EXIT();
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+void esEvtPostValueI(
+    esEpa_T *       epa,
+    esEvtId_T       id,
+    uintptr_t       value) {
 
-    indx = epa->prio & (~((portReg_T)0U) >> (PORT_DATA_WIDTH - PRIO_INDX_PWR));
-    indxGroup = epa->prio >> PRIO_INDX_PWR;
-    gRdyBitmap.bit[indxGroup] &= ~((portReg_T)1U << indx);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, (UINTPTR_MAX >> 1U) >= (uintptr_t)id);
 
-    if ((portReg_T)0U == gRdyBitmap.bit[indxGroup]) {
-        gRdyBitmap.bitGroup &= ~((portReg_T)1U << indxGroup);
+    if (FALSE == epaValuePutI_(epa, id, value)) {
+        /* Greska! Red je pun. */
+        ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
     }
-#endif
 }
+#endif
 
-/** @} *//*-------------------------------------------------------------------*/
-/*------------------------------------------------------------------------*//**
- * @name        Inicijalizacija i deinicijalizacija EPA objekta
- * @{ *//*--------------------------------------------------------------------*/
-
-/**
- * @brief       Inicijalizuje EPA objekat
- * @param       [out] epa               Pokazivac na strukturu EPA objekta,
- * @param       [in] stateQueue         memorija za cuvanje stanja HSM automata,
- * @param       [in] evtQueue           memorija za cuvanje reda za cekanje,
- * @param       [in] definition         pokazivac na definicionu strukturu EPA
- *                                      objekta.
- * @notapi
- */
-static PORT_C_INLINE void epaInit_(
-    esEpa_T *       epa,
-    esState_T *     stateQueue,
-    esEvt_T **      evtQueue,
-    const PORT_C_ROM esEpaDef_T * definition) {
+/*----------------------------------------------------------------------------*/
+size_t esEvtRecall(
+    esEpa_T *       epa) {
 
     PORT_CRITICAL_DECL;
+    size_t nEvt;
 
-    smInit(
-        (esSm_T *)epa,
-        definition->smInitState,
-        stateQueue,
-        definition->smLevels);
-    evtQInit(
-        &epa->evtQueue,
-        evtQueue,
-        definition->evtQueueLevels);
-    epa->prio = definition->epaPrio;
-    epa->name = definition->epaName;
-    ES_KERN_API_OBLIGATION(epa->signature = EPA_SIGNATURE);
     PORT_CRITICAL_ENTER();
-    schedRdyRegI_(
+    nEvt = esEvtRecallI(
         epa);
-    esEvtPostI(                                                                 /* Postavi dogadjaj INIT u redu cekanja ovog automata.      */
-        epa,
-        (esEvt_T *)&evtSignal[SIG_INIT]);
     PORT_CRITICAL_EXIT();
+
+    return (nEvt);
 }
 
-/**
- * @brief       DeInicijalizuje EPA objekat
- * @param       [out] epa               Pokazivac na strukturu EPA objekta.
- * @notapi
- */
-static PORT_C_INLINE void esEpaDeInit_(
+/*----------------------------------------------------------------------------*/
+size_t esEvtRecallI(
     esEpa_T *       epa) {
 
-    PORT_CRITICAL_DECL;
+    struct evtDeferSlot * slot;
+    uint_fast16_t nEvt;
+    uint_fast16_t cnt;
 
-    PORT_CRITICAL_ENTER();
-    schedRdyRmI_(
-        epa);
-    schedRdyUnRegI_(
-        epa);
-    PORT_CRITICAL_EXIT();
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
 
-    while (FALSE == evtQIsEmptyI_(&epa->evtQueue)) {
-        esEvt_T * evt;
+    slot = epa->evtDefer.slot;
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    nEvt = 0U;
+
+    while (nEvt < epa->evtDefer.count) {                                        /* Lock-free red ne podrzava upis na pocetak.               */
+        bool_T isPut;
+
+# if (1U == OPT_KERNEL_EVT_VALUE)
+        if ((esEvt_T *)0U == slot[nEvt].evt) {
+            isPut = epaValuePutI_(
+                epa,
+                slot[nEvt].id,
+                slot[nEvt].value);
+        } else {
+            isPut = epaEvtPutI_(
+                epa,
+                slot[nEvt].evt);
+        }
+# else
+        isPut = epaEvtPutI_(
+            epa,
+            slot[nEvt].evt);
+# endif
 
-        evt = evtQGetI_(
-            &epa->evtQueue);
-        PORT_CRITICAL_ENTER();
-        esEvtDestroyI(
-            evt);
-        PORT_CRITICAL_EXIT();
+        if (FALSE == isPut) {
+
+            break;
+        }
+        nEvt++;
     }
-    evtQDeInit(
-        &epa->evtQueue);
-    smDeInit(
-        &epa->sm);
+#else
+    {
+        size_t room;
 
-    ES_KERN_API_OBLIGATION(epa->signature = ~EPA_SIGNATURE);
-}
+        room = evtQFreeI_(
+            &epa->evtQueue);
+        nEvt = 0U;
 
-/** @} *//*-------------------------------------------------------------------*/
-/*------------------------------------------------------------------------*//**
- * @name        Ostale lokalne funkcije
- * @{ *//*--------------------------------------------------------------------*/
+        while (nEvt < epa->evtDefer.count) {                                    /* Najstariji dogadjaji koji staju u red.                   */
+            size_t need;
 
-/**
- * @brief       Dobavlja dogadjaj iz reda za cekanje @c aEvtQueue
- * @param       epa                    Pokazivac na red za cekanje.
- * @return      Dogadjaj iz reda cekanja.
- * @notapi
- */
-esEvt_T * evtFetchI(
-    esEpa_T *       epa) {
+            need = 1U;
+# if (1U == OPT_KERNEL_EVT_VALUE)
 
-    esEvt_T * evt;
+            if ((esEvt_T *)0U == slot[nEvt].evt) {
+                need = 2U;
+            }
+# endif
 
-    evt = evtQGetI_(
-        &epa->evtQueue);
-    evtUsrRmI_(
-        evt);
+            if (need > room) {
 
-    if (TRUE == evtQIsEmptyI_(&epa->evtQueue)) {
-        schedRdyRmI_(
-            epa);
+                break;
+            }
+            room -= need;
+            nEvt++;
+        }
+
+        if ((0U != nEvt) && (TRUE == epaIsIdleI_(epa))) {
+            schedRdyInsertI_(
+                epa);
+        }
+        cnt = nEvt;
+
+        while (0U != cnt) {                                                     /* Upis na pocetak obrnutim redom, najstariji ostaje prvi.  */
+            cnt--;
+# if (1U == OPT_KERNEL_EVT_VALUE)
+
+            if ((esEvt_T *)0U == slot[cnt].evt) {
+                evtQPutValueAheadI_(
+                    &epa->evtQueue,
+                    slot[cnt].id,
+                    slot[cnt].value);
+            } else {
+                evtQPutAheadI_(
+                    &epa->evtQueue,
+                    slot[cnt].evt);
+            }
+# else
+            evtQPutAheadI_(
+                &epa->evtQueue,
+                slot[cnt].evt);
+# endif
+        }
+    }
+#endif
+    epa->evtDefer.count -= nEvt;
+
+    for (cnt = 0U; cnt < epa->evtDefer.count; cnt++) {                          /* Preostali dogadjaji se pomeraju na pocetak bafera.       */
+        slot[cnt] = slot[cnt + nEvt];
     }
+    epa->evtDefer.status.recalled += (uint32_t)nEvt;
 
-    return (evt);
+    return ((size_t)nEvt);
 }
 
-/** @} *//*-------------------------------------------------------------------*/
-/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
-/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+/*----------------------------------------------------------------------------*/
+void esEpaDeferStatusGet(
+    const esEpa_T * epa,
+    esEpaDeferStatus_T * status) {
+
+    PORT_CRITICAL_DECL;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != status);
+
+    PORT_CRITICAL_ENTER();
+    *status = epa->evtDefer.status;
+    PORT_CRITICAL_EXIT();
+}
 
+#if (0U != OPT_KERNEL_EVT_SPILL)
 /*----------------------------------------------------------------------------*/
-void esEvtPost(
-    esEpa_T *       epa,
-    esEvt_T *       evt) {
+void esEpaSpillStatusGet(
+    const esEpa_T * epa,
+    esEpaSpillStatus_T * status) {
 
     PORT_CRITICAL_DECL;
 
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != status);
+
     PORT_CRITICAL_ENTER();
-    esEvtPostI(
-       epa,
-       evt);
+    *status = epa->evtSpill;
     PORT_CRITICAL_EXIT();
 }
+#endif
 
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
 /*----------------------------------------------------------------------------*/
-void esEvtPostI(
+void esEpnSubscribe(
     esEpa_T *       epa,
-    esEvt_T *       evt) {
+    esEvtId_T       id) {
+
+    PORT_CRITICAL_DECL;
 
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
-    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
-    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, OPT_KERNEL_EPN_SIGNAL_MAX > id);
 
-    if (TRUE == evtQIsEmptyI_(&epa->evtQueue)) {
-        schedRdyInsertI_(
-            epa);
-        evtQPutI_(
-            &epa->evtQueue,
-            evt);
-        evtUsrAddI_(
-            evt);
-    } else if (FALSE == evtQIsFullI_(&epa->evtQueue)) {
-        evtQPutI_(
-            &epa->evtQueue,
-            evt);
-        evtUsrAddI_(
-            evt);
-    } else {
-        /* Greska! Red je pun. */
-    	ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
+    PORT_CRITICAL_ENTER();
 
-        esEvtDestroyI(
-            evt);
+    if (FALSE == epnIsSubscriberI_(epa)) {                                      /* Prva pretplata, EPA objekat ulazi u listu.               */
+        epa->epnNext = gEpnEpa[epa->prio];
+        gEpnEpa[epa->prio] = epa;
     }
+    epa->epnSignal[id >> PRIO_INDX_PWR] |= (portReg_T)1U << (id & PRIO_INDX_MASK);
+    gEpnSubscr[id][epa->prio >> PRIO_INDX_PWR] |= EPN_PRIO_BIT(epa->prio);
+    PORT_CRITICAL_EXIT();
 }
 
 /*----------------------------------------------------------------------------*/
-void esEvtPostAhead(
+void esEpnUnsubscribe(
     esEpa_T *       epa,
+    esEvtId_T       id) {
+
+    PORT_CRITICAL_DECL;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, OPT_KERNEL_EPN_SIGNAL_MAX > id);
+
+    PORT_CRITICAL_ENTER();
+
+    if (EPN_IS_SIGNAL(epa, id)) {
+        epa->epnSignal[id >> PRIO_INDX_PWR] &= ~((portReg_T)1U << (id & PRIO_INDX_MASK));
+
+        if (FALSE == epnIsSubscriberI_(epa)) {                                  /* Poslednja pretplata, EPA objekat izlazi iz liste.        */
+            epnUnlinkI_(
+                epa);
+        }
+        epnPrioUpdateI_(
+            epa->prio,
+            id);
+    }
+    PORT_CRITICAL_EXIT();
+}
+
+/*----------------------------------------------------------------------------*/
+void esEvtPublish(
     esEvt_T *       evt) {
 
     PORT_CRITICAL_DECL;
 
     PORT_CRITICAL_ENTER();
-    esEvtPostAheadI(
-        epa,
+    esEvtPublishI(
         evt);
     PORT_CRITICAL_EXIT();
 }
 
 /*----------------------------------------------------------------------------*/
-void esEvtPostAheadI(
-    esEpa_T *       epa,
+void esEvtPublishI(
     esEvt_T *       evt) {
 
-    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
-    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EPA_SIGNATURE == epa->signature);
+    uint_fast16_t nUsr;
+    uint_fast16_t word;
+
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, EVT_SIGNATURE == evt->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, OPT_KERNEL_EPN_SIGNAL_MAX > evt->id);
 
-    if (TRUE == evtQIsEmptyI_(&epa->evtQueue)) {
-        schedRdyInsertI_(
-            epa);
-        evtQPutAheadI_(
-            &epa->evtQueue,
-            evt);
-        evtUsrAddI_(
-            evt);
-    } else if (FALSE == evtQIsFullI_(&epa->evtQueue)) {
-        evtQPutAheadI_(
-            &epa->evtQueue,
-            evt);
-        evtUsrAddI_(
-            evt);
+    nUsr = 0U;
+    word = EPN_WORDS;
+
+    while (0U != word) {                                                        /* Pretplatnici se obilaze od najviseg prioriteta.          */
+        portReg_T subscr;
+
+        word--;
+        subscr = gEpnSubscr[evt->id][word];
+
+        while ((portReg_T)0U != subscr) {
+            uint_fast8_t bit;
+            esEpa_T * epa;
+
+            bit = PORT_FIND_LAST_SET(subscr);
+            subscr &= ~((portReg_T)1U << bit);
+            epa = gEpnEpa[(word << PRIO_INDX_PWR) | bit];
+
+            while ((esEpa_T *)0U != epa) {                                      /* Svi pretplatnici istog prioriteta.                       */
+
+                if (EPN_IS_SIGNAL(epa, evt->id)) {
+
+                    if (TRUE == epaEvtPutI_(epa, evt)) {
+                        nUsr++;
+                    } else {
+                        /* Greska! Red pretplatnika je pun. */
+                        ES_KERN_ASSERT(ES_KERN_NOT_ENOUGH_MEM, FALSE);
+                    }
+                }
+                epa = epa->epnNext;
+            }
+        }
+    }
+
+    if (0U != nUsr) {
+        evtUsrAddNI_(                                                           /* Kriticna sekcija traje do kraja, pa ni jedan pretplatnik */
+            evt,                                                                /* nije mogao da obradi dogadjaj pre ovog povecanja.        */
+            nUsr);
     } else {
-        /* Greska! Red je pun. */
         esEvtDestroyI(
             evt);
     }
 }
+#endif
 
 /*----------------------------------------------------------------------------*/
 esEpa_T * esEpaCreate(
@@ -535,15 +2491,42 @@ esEpa_T * esEpaCreate(
     size_t coreSize;
     size_t smpQSize;
     size_t evtQSize;
+    size_t evtQLevels;
+    size_t urgQSize;
+    size_t urgQLevels;
+    size_t deferSize;
 
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, (memClass == &esMemDynClass) || (memClass == &esMemStaticClass));
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != definition);
     ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, OPT_KERNEL_EPA_PRIO_MAX > definition->epaPrio);
     ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, 0U < definition->evtQueueLevels);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, UINT_FAST16_MAX >= definition->evtDeferLevels);
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, 0U < definition->evtUrgentLevels);
+#endif
+#if (1U < OPT_KERNEL_CPU_NUM)
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, OPT_KERNEL_CPU_NUM > definition->epaCpu);
+#endif
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != definition->smTable);
+#else
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != definition->smInitState);
     ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, 2U <= definition->smLevels);
+#endif
     ES_KERN_API_REQUIRE(ES_KERN_USAGE_FAILURE, sizeof(esEpa_T) <= definition->epaWorkspaceSize);
 
+    evtQLevels = evtQCapacity(                                                  /* Zaokruzi na stepen dvojke ako red to zahteva.            */
+        definition->evtQueueLevels);
+#if (1U == OPT_KERNEL_EVTQ_URGENT)
+    urgQLevels = evtQCapacity(
+        definition->evtUrgentLevels);
+    urgQSize = evtQReqSize(
+        urgQLevels);
+#else
+    urgQLevels = 0U;
+    urgQSize = 0U;
+#endif
+
 #if !defined(PORT_SUPP_UNALIGNED_ACCESS) || defined(OPT_OPTIMIZE_SPEED)         /* Ukoliko port ne podrzava UNALIGNED ACCESS ili je ukljuce-*/
                                                                                 /* na optimizacija za brzinu vrsi se zaokruzivanje velicina */
                                                                                 /* radi brzeg pristupa memoriji.                            */
@@ -551,18 +2534,26 @@ esEpa_T * esEpaCreate(
         definition->epaWorkspaceSize, PORT_DATA_ALIGNMENT);
     smpQSize = GP_ALIGN(
         stateQReqSize(
-            definition->smLevels),
+            definition->smLevels,
+            definition->smStateTable),
         PORT_DATA_ALIGNMENT);
     evtQSize = GP_ALIGN(
         evtQReqSize(
-            definition->evtQueueLevels),
+            evtQLevels),
+        PORT_DATA_ALIGNMENT);
+    urgQSize = GP_ALIGN(
+        urgQSize, PORT_DATA_ALIGNMENT);
+    deferSize = GP_ALIGN(
+        definition->evtDeferLevels * sizeof(struct evtDeferSlot),
         PORT_DATA_ALIGNMENT);
 #else
     coreSize = definition->epaWorkspaceSize;
     smpQSize = stateQReqSize(
-        definition->smLevels);
+        definition->smLevels,
+        definition->smStateTable);
     evtQSize = evtQReqSize(
-        definition->evtQueueLevels
+        evtQLevels);
+    deferSize = definition->evtDeferLevels * sizeof(struct evtDeferSlot);
 #endif
 
 #if (OPT_MM_DISTRIBUTION == ES_MM_DYNAMIC_ONLY)
@@ -571,9 +2562,9 @@ esEpa_T * esEpaCreate(
 
         (void)memClass;
         PORT_CRITICAL_ENTER();
-        newEpa = esDMemAllocI(
-            &DefDMemHandle,
-            coreSize + smpQSize + evtQSize);
+        newEpa = OPT_MEM_DYN_ALLOCI(
+            OPT_MEM_DYN_HANDLE,
+            coreSize + smpQSize + evtQSize + urgQSize + deferSize);
         PORT_CRITICAL_EXIT();
     }
 #elif (OPT_MM_DISTRIBUTION == ES_MM_STATIC_ONLY)
@@ -583,17 +2574,21 @@ esEpa_T * esEpaCreate(
         (void)memClass;
         PORT_CRITICAL_ENTER();
         newEpa = esSmemAllocI(
-            coreSize + smpQSize + evtQSize);
+            coreSize + smpQSize + evtQSize + urgQSize + deferSize);
         PORT_CRITICAL_EXIT();
     }
 #else
-    newEpa = (* memClass->alloc)(coreSize + smpQSize + evtQSize);
+    newEpa = (* memClass->alloc)(coreSize + smpQSize + evtQSize + urgQSize + deferSize);
     *((const PORT_C_ROM struct memClass **)newEpa) = memClass;
 #endif
     epaInit_(
         (esEpa_T *)newEpa,
         (esState_T *)(newEpa + coreSize),
         (esEvt_T **)(newEpa + coreSize + smpQSize),
+        evtQLevels,
+        (esEvt_T **)(newEpa + coreSize + smpQSize + evtQSize),
+        urgQLevels,
+        (struct evtDeferSlot *)(newEpa + coreSize + smpQSize + evtQSize + urgQSize),
         definition);
 
     return ((esEpa_T *)newEpa);
@@ -614,8 +2609,8 @@ void esEpaDestroy(
     esEpaDeInit_(
         epa);
     PORT_CRITICAL_ENTER();
-    esDMemDeAllocI(
-        &DefDMemHandle,
+    OPT_MEM_DYN_DEALLOCI(
+        OPT_MEM_DYN_HANDLE,
         epa);
     PORT_CRITICAL_EXIT();
 #else
@@ -629,11 +2624,11 @@ void esEpaDestroy(
 esEpa_T * esEpaGet(
     void) {
 
-    return (gCurrentEpa);
+    return (gCurrentEpa[CPU_ID()]);
 }
 
 /*----------------------------------------------------------------------------*/
-uint8_t esEpaPrioGet(
+uint16_t esEpaPrioGet(
     const esEpa_T * epa) {
 
     ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
@@ -645,7 +2640,7 @@ uint8_t esEpaPrioGet(
 /*----------------------------------------------------------------------------*/
 void esEpaPrioSet(
     esEpa_T *       epa,
-    uint8_t         newPrio) {
+    uint16_t        newPrio) {
 
     PORT_CRITICAL_DECL;
     bool_T status;
@@ -659,11 +2654,17 @@ void esEpaPrioSet(
         epa);
     schedRdyRmI_(
         epa);
-    schedRdyUnRegI_(
-        epa);
-    epa->prio = (uint_fast8_t)newPrio;
-    schedRdyRegI_(
-        epa);
+#if (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
+
+    if (TRUE == epnIsSubscriberI_(epa)) {                                       /* Pretplate prate EPA objekat na nov prioritet.            */
+        epnUnlinkI_(
+            epa);
+        epa->prio = (uint_fast16_t)newPrio;
+        epnLinkI_(
+            epa);
+    }
+#endif
+    epa->prio = (uint_fast16_t)newPrio;
 
     if (TRUE == status) {
         schedRdyInsertI_(
@@ -680,6 +2681,12 @@ void esKernelInit(
 
     esSmpInit();
     schedInit();
+#if (0U != OPT_KERNEL_EVT_SPILL)
+    spillInit();
+#endif
+#if (1U == OPT_TEM_ENABLE)
+    temInit();
+#endif
 
 #if defined(OPT_STP_ENABLE)
     esStpInit();
@@ -690,41 +2697,25 @@ void esKernelInit(
 void esKernelStart(
     void) {
 
-    PORT_CRITICAL_DECL;
-
     gKernelState = KERNEL_RUNNING;
-    PORT_CRITICAL_ENTER();
-
-    while (TRUE) {
-
-        while (FALSE == schedRdyIsEmptyI_()) {
-            esEvt_T * evt;
-            esEpa_T * epa;
-            esStatus_T status;
 
-            gCurrentEpa = epa = schedRdyGetEpaI_();
-            evt = evtFetchI(
-                epa);
-            PORT_CRITICAL_EXIT();
-            status = SM_DISPATCH(
-                (esSm_T *)epa,
-                evt);
-            PORT_CRITICAL_ENTER();
+#if (1U == OPT_TEM_ENABLE)
+    PORT_SYSTMR_INIT();
+    PORT_SYSTMR_ISR_ENABLE();
+#endif
+#if (1U < OPT_KERNEL_CPU_NUM)
+    {
+        uint_fast8_t cpu;
 
-            if (RETN_DEFERRED == status) {
-                esEvtPostI(
-                    epa,
-                    evt);
-            } else {
-                esEvtDestroyI(
-                    evt);
-            }
+        for (cpu = 1U; cpu < OPT_KERNEL_CPU_NUM; cpu++) {
+            PORT_CPU_START(
+                cpu,
+                kernelDispatch);
         }
-        gCurrentEpa = (esEpa_T *)0U;
-        PORT_CRITICAL_EXIT();
-        /* ES_CPU_SLEEP(); */
-        PORT_CRITICAL_ENTER();
     }
+#endif
+    kernelDispatch(
+        0U);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -736,6 +2727,37 @@ esKernelState_T esKernelStatus(
 
 /** @} *//*-------------------------------------------------------------------*/
 /*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (1U > OPT_KERNEL_DISPATCH_BATCH) || (255U < OPT_KERNEL_DISPATCH_BATCH)
+# error "Kernel configuration: OPT_KERNEL_DISPATCH_BATCH must be in range 1 - 255."
+#endif
+
+#if (4096U < OPT_KERNEL_EPA_PRIO_MAX)
+# error "Kernel configuration: OPT_KERNEL_EPA_PRIO_MAX must not be greater than 4096."
+#endif
+
+#if (EVT_USERS_MASK < OPT_KERNEL_EPA_PRIO_MAX) && (0U != OPT_KERNEL_EPN_SIGNAL_MAX)
+# error "Kernel configuration: event user counter is too narrow for OPT_KERNEL_EPA_PRIO_MAX subscribers."
+#endif
+
+#if defined(PORT_CPU_IDLE) && !defined(PORT_CPU_WAKE)
+# error "Kernel port: PORT_CPU_IDLE requires PORT_CPU_WAKE."
+#endif
+
+#if defined(PORT_WAIT_UNTIL) && (!defined(PORT_WAIT_DEADLINE) || !defined(PORT_WAIT_WAKE))
+# error "Kernel port: PORT_WAIT_UNTIL requires PORT_WAIT_DEADLINE and PORT_WAIT_WAKE."
+#endif
+
+#if (1U == OPT_TEM_ENABLE) && !defined(PORT_SYSTMR_INIT)
+# error "Kernel port: TEM module (OPT_TEM_ENABLE) requires PORT_SYSTMR_INIT and PORT_SYSTMR_ISR_ENABLE."
+#endif
+
+#if (1U < OPT_KERNEL_CPU_NUM)
+# if !defined(PORT_CPU_ID) || !defined(PORT_CPU_START)
+#  error "Kernel port: SMP mode (OPT_KERNEL_CPU_NUM > 1) requires PORT_CPU_ID and PORT_CPU_START."
+# endif
+#endif
+
 /** @endcond *//** @} *//******************************************************
  * END of core.c
  ******************************************************************************/
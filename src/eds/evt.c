@@ -37,16 +37,90 @@
 # include <stdlib.h>
 #endif
 
+#if (2 > CFG_EVT_STORAGE) && (0 != CFG_EVT_MAG_SIZE)
+# include <stdatomic.h>
+#endif
+
 /*=========================================================  LOCAL MACRO's  ==*/
+
+/**
+ * @brief       Maska za zaokruzivanje velicine dogadjaja na klasu velicine
+ */
+#define POOL_CLASS_MASK                                                         \
+    (((size_t)1U << CFG_EVT_STORAGE_CLASS_SHIFT) - 1U)
+
+/**
+ * @brief       Broj klasa velicine u tabeli
+ */
+#define POOL_CLASS_NUM                                                          \
+    (((CFG_EVT_STORAGE_CLASS_MAX + POOL_CLASS_MASK) >> CFG_EVT_STORAGE_CLASS_SHIFT) + 1U)
+
+/**
+ * @brief       Da li se dogadjaji iz pool-ova zauzimaju bez kriticne sekcije
+ */
+#if (2 > CFG_EVT_STORAGE) && (1U == OPT_MEM_POOL_LOCKFREE)
+# define EVT_POOL_LOCKFREE              1U
+#else
+# define EVT_POOL_LOCKFREE              0U
+#endif
+
+/**
+ * @brief       Da li se koriste magacini slobodnih blokova
+ */
+#if (2 > CFG_EVT_STORAGE) && (0 != CFG_EVT_MAG_SIZE)
+# define EVT_MAG_ENABLE                 1U
+#else
+# define EVT_MAG_ENABLE                 0U
+#endif
+
+/**
+ * @brief       Broj blokova koji se odjednom prenosi izmedju magacina i pool-a
+ */
+#define EVT_MAG_BATCH                                                           \
+    ((CFG_EVT_MAG_SIZE + 1U) / 2U)
+
+/**
+ * @brief       Identifikator jezgra koje izvrsava pozivaoca
+ */
+#if (1U < OPT_KERNEL_CPU_NUM)
+# define EVT_MAG_CPU_ID()               PORT_CPU_ID()
+#else
+# define EVT_MAG_CPU_ID()               0U
+#endif
+
 /*======================================================  LOCAL DATA TYPES  ==*/
 
 #if (2 > CFG_EVT_STORAGE)
 struct evtPools {
-    esPMemHandle_T *    handle[CFG_EVT_STORAGE_NPOOL];
+    OPT_MEM_POOL_T *    handle[CFG_EVT_STORAGE_NPOOL];                          /**< @brief Skladista sortirana po velicini bloka           */
+    uint8_t             sizeClass[POOL_CLASS_NUM];                              /**< @brief Indeks prvog skladista za klasu velicine        */
     uint_fast8_t        npool;
 };
 #endif
 
+#if (1U == EVT_MAG_ENABLE)
+/**
+ * @brief       Magacin slobodnih blokova jednog pool-a
+ */
+struct evtMag {
+    OPT_MEM_POOL_T *    pool;                                                   /**< @brief Pool kome pripadaju blokovi, NULL ako je slobodan*/
+    void *              block[CFG_EVT_MAG_SIZE];                                /**< @brief Stek slobodnih blokova                          */
+    uint_fast8_t        count;                                                  /**< @brief Broj blokova u magacinu                         */
+};
+
+/**
+ * @brief       Magacini jednog jezgra
+ * @details     Magacine koristi samo onaj ko postavi @c isBusy. Prekidna rutina
+ *              ili nit koja zatekne postavljen @c isBusy zauzima i oslobadja
+ *              blokove direktno u pool-u.
+ */
+struct evtMagCpu {
+    atomic_bool         isBusy;                                                 /**< @brief Magacini su u upotrebi                          */
+    struct evtMag       mag[CFG_EVT_STORAGE_NPOOL];                             /**< @brief Po jedan magacin za svaki registrovan pool      */
+    esEvtMagStatus_T    status;                                                 /**< @brief Statistika magacina                             */
+};
+#endif
+
 /*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
 
 /**
@@ -70,6 +144,108 @@ static PORT_C_INLINE_ALWAYS void evtInit_(
 static PORT_C_INLINE_ALWAYS void evtDeInit_(
     esEvt_T *           evt);
 
+#if (2 > CFG_EVT_STORAGE)
+/**
+ * @brief       Ponovo gradi tabelu klasa velicine skladista
+ * @details     Za svaku klasu velicine upisuje indeks najmanjeg skladista ciji
+ *              blok moze da primi dogadjaj najmanje velicine u toj klasi. Poziva
+ *              se samo prilikom registracije i deregistracije skladista.
+ * @notapi
+ */
+static void poolClassBuildI(
+    void);
+
+/**
+ * @brief       Pronalazi najmanje skladiste koje moze da primi dogadjaj
+ * @param       size                    Velicina dogadjaja.
+ * @return      Skladiste ili NULL ako nijedno skladiste nije dovoljno veliko.
+ * @details     Za velicine do @ref CFG_EVT_STORAGE_CLASS_MAX pretraga pocinje od
+ *              skladista iz tabele klasa velicine i preskace samo skladista
+ *              ciji se blokovi nalaze unutar iste klase, pa je trajanje
+ *              konstantno kada su velicine blokova umnosci granule. Za vece
+ *              velicine se pretrazuje cela lista skladista.
+ * @inline
+ */
+static PORT_C_INLINE OPT_MEM_POOL_T * poolFindI_(
+    size_t              size);
+#endif
+
+/**
+ * @brief       Zauzima memoriju za dogadjaj i belezi njeno poreklo
+ * @param       size                    Velicina dogadjaja.
+ * @return      Memorijski prostor za dogadjaj.
+ * @details     Kada se koriste skladista, u zaglavlje dogadjaja se upisuje
+ *              skladiste iz koga je dogadjaj zauzet, ili NULL ako je zauzet iz
+ *              dinamicke memorije. Na osnovu toga esEvtDestroyI() vraca
+ *              memoriju alokatoru iz koga je i zauzeta. Uz @ref CFG_EVT_STORAGE
+ *              0 dogadjaj se zauzima iz dinamicke memorije i kada je skladiste
+ *              prazno.
+ * @inline
+ */
+static PORT_C_INLINE esEvt_T * evtAllocI_(
+    size_t              size);
+
+/**
+ * @brief       Vraca memoriju dogadjaja alokatoru iz koga je zauzeta
+ * @param       evt                     Pokazivac na dogadjaj.
+ * @inline
+ */
+static PORT_C_INLINE void evtDeAllocI_(
+    esEvt_T *           evt);
+
+#if (2 > CFG_EVT_STORAGE)
+/**
+ * @brief       Zauzima blok iz pool-a, preko magacina kada je on ukljucen
+ * @param       pool                    Pool iz koga se zauzima blok.
+ * @return      Blok ili NULL ukoliko je pool prazan.
+ * @details     Ukoliko je opcija @ref OPT_MEM_POOL_LOCKFREE ukljucena funkcija
+ *              se moze pozvati i van kriticne sekcije.
+ * @inline
+ */
+static PORT_C_INLINE void * evtPoolAllocI_(
+    OPT_MEM_POOL_T *    pool);
+
+/**
+ * @brief       Vraca blok u pool, preko magacina kada je on ukljucen
+ * @param       pool                    Pool kome blok pripada,
+ * @param       block                   blok koji se vraca.
+ * @details     Ukoliko je opcija @ref OPT_MEM_POOL_LOCKFREE ukljucena funkcija
+ *              se moze pozvati i van kriticne sekcije.
+ * @inline
+ */
+static PORT_C_INLINE void evtPoolDeAllocI_(
+    OPT_MEM_POOL_T *    pool,
+    void *              block);
+#endif
+
+#if (1U == EVT_MAG_ENABLE)
+/**
+ * @brief       Pronalazi magacin datog pool-a ili mu dodeljuje slobodan
+ * @param       magCpu                  Magacini jezgra,
+ * @param       pool                    pool ciji se magacin trazi.
+ * @return      Magacin pool-a ili NULL ukoliko nema slobodnog magacina.
+ * @details     Pretrazuje se najvise @ref CFG_EVT_STORAGE_NPOOL magacina koji
+ *              su lokalni za jezgro. Kada je vratio NULL pozivalac koristi
+ *              pool direktno.
+ * @inline
+ */
+static PORT_C_INLINE struct evtMag * evtMagFind_(
+    struct evtMagCpu *  magCpu,
+    OPT_MEM_POOL_T *    pool);
+
+/**
+ * @brief       Vraca sve blokove iz magacina datog pool-a na svim jezgrima
+ * @param       pool                    Pool koji se deregistruje.
+ * @details     Poziva se van kriticne sekcije, nakon sto je pool uklonjen iz
+ *              tabele skladista. Na magacine jezgra koje ih trenutno koristi se
+ *              ceka bez zakljucavanja, a blokovi se vracaju unutar kriticne
+ *              sekcije.
+ * @notapi
+ */
+static void evtMagPurge(
+    OPT_MEM_POOL_T *    pool);
+#endif
+
 /*=======================================================  LOCAL VARIABLES  ==*/
 
 DECL_MODULE_INFO("EVT", "Event management", "Nenad Radulovic");
@@ -78,6 +254,10 @@ DECL_MODULE_INFO("EVT", "Event management", "Nenad Radulovic");
 static struct evtPools EvtPools;
 #endif
 
+#if (1U == EVT_MAG_ENABLE)
+static struct evtMagCpu EvtMag[OPT_KERNEL_CPU_NUM];
+#endif
+
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
 
@@ -94,13 +274,12 @@ static PORT_C_INLINE_ALWAYS void evtInit_(
 
 #if (1U == CFG_EVT_USE_TIMESTAMP)
 # if (1U == OPT_EVT_TIMESTAMP_CALLBACK)
-    evt->timestamp = appEvtTimestampGet();
-#else
+    evt->timestamp = uTimestampGet();
 # endif
 #endif
 #if (1U == CFG_EVT_USE_GENERATOR)
 # if (1U == OPT_EVT_GENERATOR_CALLBACK)
-    evt->generator = appEvtGeneratorGet();
+    evt->generator = uGeneratorGet();
 # endif
 #endif
 #if (1U == CFG_EVT_USE_SIZE)
@@ -119,12 +298,329 @@ static PORT_C_INLINE_ALWAYS void evtDeInit_(
     ES_DBG_API_OBLIGATION(evt->signature = ~EVT_SIGNATURE);
 }
 
+/*----------------------------------------------------------------------------*/
+#if (2 > CFG_EVT_STORAGE)
+static void poolClassBuildI(
+    void) {
+
+    size_t              sizeClass;
+    size_t              size;
+    uint_fast8_t        cnt;
+
+    EvtPools.sizeClass[0] = 0U;
+    sizeClass = 1U;
+    cnt = 0U;
+
+    while (POOL_CLASS_NUM > sizeClass) {
+        size = ((sizeClass - 1U) << CFG_EVT_STORAGE_CLASS_SHIFT) + 1U;          /* Najmanja velicina koja pripada ovoj klasi.               */
+
+        while ((cnt < EvtPools.npool) &&
+            (OPT_MEM_POOL_BLOCK_SIZE(EvtPools.handle[cnt]) < size)) {
+            cnt++;
+        }
+        EvtPools.sizeClass[sizeClass] = (uint8_t)cnt;
+        sizeClass++;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE OPT_MEM_POOL_T * poolFindI_(
+    size_t              size) {
+
+    uint_fast8_t        cnt;
+
+    cnt = 0U;
+
+    if (CFG_EVT_STORAGE_CLASS_MAX >= size) {
+        cnt = EvtPools.sizeClass[(size + POOL_CLASS_MASK) >> CFG_EVT_STORAGE_CLASS_SHIFT];
+    }
+
+    while (cnt < EvtPools.npool) {
+        size_t          currSize;
+
+        currSize = OPT_MEM_POOL_BLOCK_SIZE(EvtPools.handle[cnt]);
+
+        if (currSize >= size) {
+
+            return (EvtPools.handle[cnt]);
+        }
+        cnt++;
+    }
+
+    return (NULL);
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE esEvt_T * evtAllocI_(
+    size_t              size) {
+
+    esEvt_T *           newEvt;
+
+#if   (2 > CFG_EVT_STORAGE)
+    OPT_MEM_POOL_T *    pool;
+
+    pool = poolFindI_(
+        size);
+    newEvt = NULL;
+
+    if (NULL != pool) {
+        newEvt = evtPoolAllocI_(
+            pool);
+    }
+# if (0 == CFG_EVT_STORAGE)
+
+    if (NULL == newEvt) {
+        pool   = NULL;                                                          /* Nema odgovarajuceg skladista ili je skladiste prazno.    */
+        newEvt = OPT_MEM_DYN_ALLOCI(
+            OPT_MEM_DYN_HANDLE,
+            size);
+    }
+# endif
+
+    if (NULL != newEvt) {
+        newEvt->pool = pool;
+    }
+#elif (2 == CFG_EVT_STORAGE)
+    newEvt = OPT_MEM_DYN_ALLOCI(
+        OPT_MEM_DYN_HANDLE,
+        size);
+#elif (3 == CFG_EVT_STORAGE)
+    newEvt = malloc(
+        size);
+#endif
+
+    return (newEvt);
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE void evtDeAllocI_(
+    esEvt_T *           evt) {
+
+#if   (2 > CFG_EVT_STORAGE)
+    if (NULL != evt->pool) {
+        evtPoolDeAllocI_(
+            evt->pool,
+            evt);
+    } else {
+        OPT_MEM_DYN_DEALLOCI(
+            OPT_MEM_DYN_HANDLE,
+            evt);
+    }
+#elif (2 == CFG_EVT_STORAGE)
+    OPT_MEM_DYN_DEALLOCI(
+        OPT_MEM_DYN_HANDLE,
+        evt);
+#elif (3 == CFG_EVT_STORAGE)
+    free(
+        evt);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+#if (2 > CFG_EVT_STORAGE)
+static PORT_C_INLINE void * evtPoolAllocI_(
+    OPT_MEM_POOL_T *    pool) {
+
+    void *              block;
+#if (1U == EVT_MAG_ENABLE)
+    struct evtMagCpu *  magCpu;
+
+    magCpu = &EvtMag[EVT_MAG_CPU_ID()];
+
+    if (FALSE == atomic_exchange_explicit(&magCpu->isBusy, TRUE, memory_order_acquire)) {
+        struct evtMag * mag;
+
+        mag = evtMagFind_(
+            magCpu,
+            pool);
+
+        if (NULL == mag) {                                                      /* Nema slobodnog magacina za ovaj pool.                    */
+            block = OPT_MEM_POOL_ALLOCI(
+                pool);
+        } else if (0U == mag->count) {                                          /* Magacin je prazan, dopuni ga iz pool-a.                  */
+            bool_T      isPending;
+
+            magCpu->status.allocMiss++;
+            isPending = TRUE;
+
+            while ((TRUE == isPending) && (EVT_MAG_BATCH > mag->count)) {
+                block = OPT_MEM_POOL_ALLOCI(
+                    pool);
+
+                if (NULL != block) {
+                    mag->block[mag->count] = block;
+                    mag->count++;
+                } else {
+                    isPending = FALSE;
+                }
+            }
+        } else {
+            magCpu->status.allocHit++;
+        }
+
+        if (NULL != mag) {
+            block = NULL;
+
+            if (0U != mag->count) {
+                mag->count--;
+                block = mag->block[mag->count];
+            }
+        }
+        atomic_store_explicit(
+            &magCpu->isBusy,
+            FALSE,
+            memory_order_release);
+    } else {
+        block = OPT_MEM_POOL_ALLOCI(
+            pool);                                                              /* Magacin je zauzet, statistika se ne menja.               */
+    }
+#else
+    block = OPT_MEM_POOL_ALLOCI(
+        pool);
+#endif
+
+    return (block);
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE void evtPoolDeAllocI_(
+    OPT_MEM_POOL_T *    pool,
+    void *              block) {
+
+#if (1U == EVT_MAG_ENABLE)
+    struct evtMagCpu *  magCpu;
+
+    magCpu = &EvtMag[EVT_MAG_CPU_ID()];
+
+    if (FALSE == atomic_exchange_explicit(&magCpu->isBusy, TRUE, memory_order_acquire)) {
+        struct evtMag * mag;
+
+        mag = evtMagFind_(
+            magCpu,
+            pool);
+
+        if (NULL == mag) {                                                      /* Nema slobodnog magacina za ovaj pool.                    */
+            OPT_MEM_POOL_DEALLOCI(
+                pool,
+                block);
+        } else {
+
+            if (CFG_EVT_MAG_SIZE == mag->count) {                               /* Magacin je pun, vrati deo blokova u pool.                */
+                magCpu->status.freeMiss++;
+
+                while ((CFG_EVT_MAG_SIZE - EVT_MAG_BATCH) < mag->count) {
+                    mag->count--;
+                    OPT_MEM_POOL_DEALLOCI(
+                        pool,
+                        mag->block[mag->count]);
+                }
+            } else {
+                magCpu->status.freeHit++;
+            }
+            mag->block[mag->count] = block;
+            mag->count++;
+        }
+        atomic_store_explicit(
+            &magCpu->isBusy,
+            FALSE,
+            memory_order_release);
+    } else {
+        OPT_MEM_POOL_DEALLOCI(
+            pool,
+            block);
+    }
+#else
+    OPT_MEM_POOL_DEALLOCI(
+        pool,
+        block);
+#endif
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+#if (1U == EVT_MAG_ENABLE)
+static PORT_C_INLINE struct evtMag * evtMagFind_(
+    struct evtMagCpu *  magCpu,
+    OPT_MEM_POOL_T *    pool) {
+
+    struct evtMag *     mag;
+    struct evtMag *     freeMag;
+    uint_fast8_t        cnt;
+
+    mag = NULL;
+    freeMag = NULL;
+    cnt = 0U;
+
+    while ((NULL == mag) && (cnt < CFG_EVT_STORAGE_NPOOL)) {
+
+        if (pool == magCpu->mag[cnt].pool) {
+            mag = &magCpu->mag[cnt];
+        } else if ((NULL == freeMag) && (NULL == magCpu->mag[cnt].pool)) {
+            freeMag = &magCpu->mag[cnt];
+        }
+        cnt++;
+    }
+
+    if ((NULL == mag) && (NULL != freeMag)) {                                   /* Pool koji nije registrovan moze da zatekne sve magacine  */
+        freeMag->pool = pool;                                                   /* zauzete.                                                 */
+        mag = freeMag;
+    }
+
+    return (mag);
+}
+
+/*----------------------------------------------------------------------------*/
+static void evtMagPurge(
+    OPT_MEM_POOL_T *    pool) {
+
+    uint_fast8_t        cpu;
+
+    for (cpu = 0U; cpu < OPT_KERNEL_CPU_NUM; cpu++) {
+        portReg_T       intrCtx;
+        struct evtMagCpu * magCpu;
+        uint_fast8_t    cnt;
+
+        magCpu = &EvtMag[cpu];
+
+        while (TRUE == atomic_exchange_explicit(&magCpu->isBusy, TRUE, memory_order_acquire)) {
+#if defined(PORT_CPU_RELAX)
+            PORT_CPU_RELAX();                                                   /* Drugo jezgro trenutno koristi svoje magacine.            */
+#endif
+        }
+        ES_CRITICAL_LOCK_ENTER(&intrCtx);
+
+        for (cnt = 0U; cnt < CFG_EVT_STORAGE_NPOOL; cnt++) {
+            struct evtMag * mag;
+
+            mag = &magCpu->mag[cnt];
+
+            if (pool == mag->pool) {
+
+                while (0U != mag->count) {
+                    mag->count--;
+                    OPT_MEM_POOL_DEALLOCI(
+                        pool,
+                        mag->block[mag->count]);
+                }
+                mag->pool = NULL;
+            }
+        }
+        ES_CRITICAL_LOCK_EXIT(intrCtx);
+        atomic_store_explicit(
+            &magCpu->isBusy,
+            FALSE,
+            memory_order_release);
+    }
+}
+#endif
+
 /*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
 /*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
 
 /*----------------------------------------------------------------------------*/
 void esEvtPoolRegister(
-    esPMemHandle_T *    handle) {
+    OPT_MEM_POOL_T *    handle) {
 
 #if (2 > CFG_EVT_STORAGE)
     portReg_T           intrCtx;
@@ -133,7 +629,7 @@ void esEvtPoolRegister(
 
     ES_DBG_API_REQUIRE(ES_DBG_NOT_ENOUGH_MEM, CFG_EVT_STORAGE_NPOOL != EvtPools.npool);
 
-    size = ES_PMEM_ATTR_BLOCK_SIZE_GET(handle);
+    size = OPT_MEM_POOL_BLOCK_SIZE(handle);
     ES_CRITICAL_LOCK_ENTER(&intrCtx);
     cnt  = EvtPools.npool;
 
@@ -141,7 +637,7 @@ void esEvtPoolRegister(
         size_t          currSize;
 
         EvtPools.handle[cnt] = EvtPools.handle[cnt - 1];
-        currSize = ES_PMEM_ATTR_BLOCK_SIZE_GET(EvtPools.handle[cnt]);
+        currSize = OPT_MEM_POOL_BLOCK_SIZE(EvtPools.handle[cnt]);
 
         if (currSize <= size) {
 
@@ -151,20 +647,23 @@ void esEvtPoolRegister(
     }
     EvtPools.handle[cnt] = handle;
     EvtPools.npool++;
+    poolClassBuildI();
     ES_CRITICAL_LOCK_EXIT(intrCtx);
 #endif
 }
 
 /*----------------------------------------------------------------------------*/
 void esEvtPoolUnregister(
-    esPMemHandle_T *    handle) {
+    OPT_MEM_POOL_T *    handle) {
 
 #if (2 > CFG_EVT_STORAGE)
     portReg_T           intrCtx;
     uint_fast8_t        cnt;
 
+    ES_DBG_API_REQUIRE(ES_DBG_OUT_OF_RANGE, 0U != EvtPools.npool);
+
     ES_CRITICAL_LOCK_ENTER(&intrCtx);
-    cnt = EvtPools.npool;
+    cnt = EvtPools.npool - 1U;
 
     while ((0u < cnt) && (handle != EvtPools.handle[cnt])) {
         cnt--;
@@ -177,30 +676,28 @@ void esEvtPoolUnregister(
         EvtPools.handle[cnt] = EvtPools.handle[cnt + 1];
         cnt++;
     }
-    EvtPools.handle[EvtPools.npool - 1] = NULL;
+    EvtPools.handle[EvtPools.npool] = NULL;
+    poolClassBuildI();
     ES_CRITICAL_LOCK_EXIT(intrCtx);
+#if (1U == EVT_MAG_ENABLE)
+    evtMagPurge(                                                                /* Pool vise nije u tabeli, magacini se ne pune iz njega.   */
+        handle);
+#endif
 #endif
 }
 
-static PORT_C_INLINE esPMemHandle_T * poolFindI_(size_t size) {
-    uint_fast8_t        cnt;
-
-    cnt = 0u;
-
-    while (cnt < EvtPools.npool) {
-        size_t          currSize;
-
-        currSize = ES_PMEM_ATTR_BLOCK_SIZE_GET(EvtPools.handle[cnt]);
+/*----------------------------------------------------------------------------*/
+#if (1U == EVT_MAG_ENABLE)
+void esEvtMagStatusGet(
+    uint_fast8_t        cpu,
+    esEvtMagStatus_T *  status) {
 
-        if (currSize >= size) {
+    ES_DBG_API_REQUIRE(ES_DBG_OUT_OF_RANGE, OPT_KERNEL_CPU_NUM > cpu);
+    ES_DBG_API_REQUIRE(ES_DBG_POINTER_NULL, NULL != status);
 
-            return (EvtPools.handle[cnt]);
-        }
-        cnt++;
-    }
-
-    return (NULL);
+    *status = EvtMag[cpu].status;
 }
+#endif
 
 /*----------------------------------------------------------------------------*/
 esEvt_T * esEvtCreate(
@@ -212,45 +709,33 @@ esEvt_T * esEvtCreate(
 
     ES_DBG_API_REQUIRE(ES_DBG_OUT_OF_RANGE, sizeof(esEvt_T) <= size);
 
-    ES_CRITICAL_LOCK_ENTER(&intrCtx);
-#if   (0 == CFG_EVT_STORAGE)
+#if (1U == EVT_POOL_LOCKFREE)
     {
-        esPMemHandle_T * pool;
+        OPT_MEM_POOL_T * pool;
 
         pool = poolFindI_(
-            size);
+            size);                                                              /* Tabela se menja samo pri registraciji pool-ova.          */
 
         if (NULL != pool) {
-            newEvt = esPMemAllocI(
+            newEvt = evtPoolAllocI_(
                 pool);
+
+            if (NULL != newEvt) {
+                newEvt->pool = pool;
+            }
         } else {
-            newEvt = esDMemAllocI(
-                &DefDMemHandle,
+            ES_CRITICAL_LOCK_ENTER(&intrCtx);
+            newEvt = evtAllocI_(
                 size);
+            ES_CRITICAL_LOCK_EXIT(intrCtx);
         }
     }
-#elif (1 == CFG_EVT_STORAGE)
-    {
-        esPMemHandle_T * pool;
-
-        pool = poolFindI_(
-            size);
-        newEvt = NULL;
-
-        if (NULL != pool) {
-            newEvt = esPMemAllocI(
-                pool);
-        }
-    }
-#elif (2 == CFG_EVT_STORAGE)
-    newEvt = esDmemAllocI(
-        &DefDMemHandle,
-        size);
-#elif (3 == CFG_EVT_STORAGE)
-    newEvt = malloc(
+#else
+    ES_CRITICAL_LOCK_ENTER(&intrCtx);
+    newEvt = evtAllocI_(
         size);
-#endif
     ES_CRITICAL_LOCK_EXIT(intrCtx);
+#endif
     evtInit_(
         newEvt,
         size,
@@ -268,8 +753,7 @@ esEvt_T * esEvtCreateI(
 
     ES_DBG_API_REQUIRE(ES_DBG_OUT_OF_RANGE, sizeof(esEvt_T) <= size);
 
-    newEvt = esDMemAllocI(
-        &DefDMemHandle,
+    newEvt = evtAllocI_(
         size);                                                                  /* Dobavi potreban memorijski prostor za dogadjaj           */
     evtInit_(
         newEvt,
@@ -305,10 +789,24 @@ void esEvtDestroy(
 
     portReg_T           intrCtx;
 
+#if (1U == EVT_POOL_LOCKFREE)
+    ES_DBG_API_REQUIRE(ES_DBG_POINTER_NULL, NULL != evt);
+
+    if (NULL != evt->pool) {                                                    /* Pool dogadjaj se vraca bez kriticne sekcije.             */
+        esEvtDestroyI(
+            evt);
+    } else {
+        ES_CRITICAL_LOCK_ENTER(&intrCtx);
+        esEvtDestroyI(
+            evt);
+        ES_CRITICAL_LOCK_EXIT(intrCtx);
+    }
+#else
     ES_CRITICAL_LOCK_ENTER(&intrCtx);
     esEvtDestroyI(
         evt);
     ES_CRITICAL_LOCK_EXIT(intrCtx);
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -321,8 +819,7 @@ void esEvtDestroyI(
     if (0U == evt->attrib) {
         evtDeInit_(
             evt);
-        esDMemDeAllocI(
-            &DefDMemHandle,
+        evtDeAllocI_(
             evt);
     }
 }
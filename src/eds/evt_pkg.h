@@ -38,10 +38,13 @@
 
 /**
  * @brief       Bit maska za brojac korisnika dogadjaja
- * @details     Brojac korisnika je 8-bitni, što znači da maksimalan broj
- *              korisnika dogadjaja u jednom trenutku iznosi 255 EPA objekata.
+ * @details     Brojac korisnika zauzima sve bite atributa ispod
+ *              @ref EVT_RESERVED_Msk, sto znači da maksimalan broj korisnika
+ *              dogadjaja u jednom trenutku iznosi 16383 EPA objekata. Ovo je
+ *              dovoljno da se jedan dogadjaj objavi svim EPA objektima kada je
+ *              @ref OPT_KERNEL_EPA_PRIO_MAX najveci moguci.
  */
-#define EVT_USERS_MASK                  (0x3FU)
+#define EVT_USERS_MASK                  (0x3FFFU)
 
 /**
  * @brief       Konstanta za potpis dogadjaja
@@ -73,7 +76,33 @@ static PORT_C_INLINE_ALWAYS void evtUsrAddI_(
     esEvt_T *       evt) {
 
     if (0U == (EVT_CONST_Msk & evt->attrib)) {                                 /* Da li je dogadjaj dinamičan?                             */
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+        (void)__atomic_fetch_add(&evt->attrib, 1U, __ATOMIC_RELAXED);           /* Dogadjaj se salje i van kriticne sekcije.                */
+#else
         ++evt->attrib;
+#endif
+    }
+}
+
+/**
+ * @brief       Povecava broj korisnika dogadjaja za @c nUsr odjednom
+ * @param       evt
+ *              Dogadjaj koji ce se koristiti
+ * @param       nUsr
+ *              Broj novih korisnika
+ * @details     Koristi se prilikom objavljivanja dogadjaja, kada dogadjaj
+ *              dobija sve pretplatnike u jednom prolazu.
+ */
+static PORT_C_INLINE_ALWAYS void evtUsrAddNI_(
+    esEvt_T *       evt,
+    uint_fast16_t   nUsr) {
+
+    if (0U == (EVT_CONST_Msk & evt->attrib)) {                                 /* Da li je dogadjaj dinamičan?                             */
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+        (void)__atomic_fetch_add(&evt->attrib, (uint16_t)nUsr, __ATOMIC_RELAXED);
+#else
+        evt->attrib += (uint16_t)nUsr;
+#endif
     }
 }
 
@@ -86,8 +115,46 @@ static PORT_C_INLINE_ALWAYS void evtUsrRmI_(
     esEvt_T *       evt) {
 
     if (0U == (EVT_CONST_Msk & evt->attrib)) {                                 /* Da li je dogadjaj dinamičan?                             */
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+        (void)__atomic_fetch_sub(&evt->attrib, 1U, __ATOMIC_ACQ_REL);
+#else
         --evt->attrib;
+#endif
+    }
+}
+
+/**
+ * @brief       Smanjuje broj korisnika dogadjaja i proverava da li je to bio
+ *              poslednji korisnik
+ * @param       evt
+ *              Dogadjaj koji se koristio
+ * @return      Da li je broj korisnika dinamickog dogadjaja upravo pao na nulu
+ * @details     Smanjivanje i provera se rade jednom operacijom, tako da samo
+ *              jedan od korisnika koji istovremeno otpustaju dogadjaj dobija
+ *              TRUE i sme da ga unisti.
+ */
+static PORT_C_INLINE_ALWAYS bool_T evtUsrRmIsLastI_(
+    esEvt_T *       evt) {
+
+    bool_T answer;
+
+    answer = FALSE;
+
+    if (0U == (EVT_CONST_Msk & evt->attrib)) {                                 /* Da li je dogadjaj dinamičan?                             */
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+
+        if (0U == __atomic_sub_fetch(&evt->attrib, 1U, __ATOMIC_ACQ_REL)) {
+            answer = TRUE;
+        }
+#else
+
+        if (0U == --evt->attrib) {
+            answer = TRUE;
+        }
+#endif
     }
+
+    return (answer);
 }
 
 /*--------------------------------------------------------  C++ extern end  --*/
@@ -35,35 +35,134 @@
 /*=========================================================  LOCAL MACRO's  ==*/
 /*======================================================  LOCAL DATA TYPES  ==*/
 /*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**
+ * @brief       Da li lokacija reda sadrzi dogadjaj sa istim identifikatorom
+ * @param       entry                   Sadrzaj lokacije reda,
+ * @param       evt                     dogadjaj sa kojim se poredi.
+ */
+static PORT_C_INLINE bool_T evtQIsSameId_(
+    const esEvt_T * entry,
+    const esEvt_T * evt);
+
 /*=======================================================  LOCAL VARIABLES  ==*/
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE bool_T evtQIsSameId_(
+    const esEvt_T * entry,
+    const esEvt_T * evt) {
+
+    bool_T answer;
+
+    answer = FALSE;
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+    if ((!EVTQ_IS_VALUE(entry)) && (entry->id == evt->id)) {
+#else
+    if (entry->id == evt->id) {
+#endif
+        answer = TRUE;
+    }
+
+    return (answer);
+}
+
 /*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
 
+/*----------------------------------------------------------------------------*/
+size_t evtQCapacity(
+    size_t          levels) {
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE) || (1U == OPT_KERNEL_EVTQ_POW2)
+    size_t capacity;
+
+    capacity = 1U;
+
+    while (capacity < levels) {
+        capacity <<= 1U;
+    }
+
+    return (capacity);
+#else
+
+    return (levels);
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 size_t evtQReqSize(
-    uint8_t         levels) {
+    size_t          levels) {
 
-    return ((size_t)(levels * sizeof(void **)));
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    return (evtQCapacity(levels) * sizeof(struct evtQSlot));
+#else
+    return (evtQCapacity(levels) * sizeof(void **));
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
 void evtQInit(
     evtQueue_T *    evtQ,
     esEvt_T **      evtQBuff,
-    uint8_t         size) {
+    size_t          size) {
 
     if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_EPA)) {
         ES_LOG_DBG_IF_INVALID(&gKernelLog, size >= 1UL, LOG_EVTQ_INIT, ES_ARG_OUT_OF_RANGE);
     }
 
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    {
+        size_t capacity;
+        size_t cnt;
+
+        capacity = evtQCapacity(
+            size);
+        evtQ->slot = (struct evtQSlot *)evtQBuff;
+        evtQ->mask = capacity - 1U;
+        evtQ->head = 0U;
+        atomic_init(
+            &evtQ->tail,
+            0U);
+        atomic_init(
+            &evtQ->count,
+            0U);
+        atomic_init(
+            &evtQ->isStalled,
+            FALSE);
+
+        for (cnt = 0U; cnt < capacity; cnt++) {
+            atomic_init(
+                &evtQ->slot[cnt].seq,
+                cnt);
+        }
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+        atomic_init(
+            &evtQ->freeMin,
+            capacity);
+# endif
+    }
+#elif (1U == OPT_KERNEL_EVTQ_POW2)
+    size = evtQCapacity(
+        size);
+    esQpPow2Init_(
+        &evtQ->queue,
+        (void **)evtQBuff,
+        size);
+
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+    evtQ->freeMin = evtQ->free = size;
+# endif
+#else
     esQpInit_(
         &evtQ->queue,
         (void **)evtQBuff,
         size);
 
-#if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
     evtQ->freeMin = evtQ->free = size;
+# endif
 #endif
 }
 
@@ -71,17 +170,145 @@ void evtQInit(
 void evtQDeInit(
     evtQueue_T *    evtQ) {
 
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    evtQ->slot = (struct evtQSlot *)0U;
+    evtQ->mask = 0U;
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+    atomic_store(
+        &evtQ->freeMin,
+        0U);
+# endif
+#elif (1U == OPT_KERNEL_EVTQ_POW2)
+    (void)esQpPow2DeInit_(
+        &evtQ->queue);
+
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+    evtQ->freeMin = evtQ->free = 0U;
+# endif
+#else
     esQpDeInit_(
         &evtQ->queue);
 
-#if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+# if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
     evtQ->freeMin = evtQ->free = 0U;
+# endif
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+esEvt_T * evtQReplaceI(
+    evtQueue_T *    evtQ,
+    esEvt_T *       evt) {
+
+    esEvt_T * old;
+
+    old = (esEvt_T *)0U;
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+    {
+        size_t pos;
+        size_t tail;
+
+        tail = atomic_load_explicit(
+            &evtQ->tail,
+            memory_order_acquire);
+
+        for (pos = evtQ->head; pos != tail; pos++) {
+            struct evtQSlot * slot;
+
+            slot = &evtQ->slot[pos & evtQ->mask];
+
+            if (((pos + 1U) == atomic_load_explicit(&slot->seq, memory_order_acquire)) &&
+                (TRUE == evtQIsSameId_(slot->evt, evt))) {                      /* Upisanu lokaciju dispecer cita samo unutar kriticne      */
+                old = slot->evt;                                                /* sekcije, pa je zamena bezbedna.                          */
+                slot->evt = evt;
+
+                break;
+            }
+        }
+    }
+#elif (1U == OPT_KERNEL_EVTQ_POW2)
+    {
+        size_t pos;
+
+        pos = evtQ->queue.head;
+
+        while (pos != evtQ->queue.tail) {
+            void ** entry;
+
+            entry = &evtQ->queue.buff[pos & evtQ->queue.mask];
+
+            if (TRUE == evtQIsSameId_((esEvt_T *)*entry, evt)) {
+                old = (esEvt_T *)*entry;
+                *entry = (void *)evt;
+
+                break;
+            }
+# if (1U == OPT_KERNEL_EVT_VALUE)
+
+            if (EVTQ_IS_VALUE(*entry)) {                                        /* Preskoci lokaciju sa vrednoscu.                          */
+                pos++;
+            }
+# endif
+            pos++;
+        }
+    }
+#else
+    {
+        void ** entry;
+
+        entry = evtQ->queue.head;
+
+        while (entry != evtQ->queue.tail) {
+# if (1U == OPT_KERNEL_EVT_VALUE)
+            bool_T isValue;
+
+            isValue = EVTQ_IS_VALUE(*entry);
+# endif
+
+            if (TRUE == evtQIsSameId_((esEvt_T *)*entry, evt)) {
+                old = (esEvt_T *)*entry;
+                *entry = (void *)evt;
+
+                break;
+            }
+
+            if (entry != evtQ->queue.end) {
+                ++entry;
+            } else {
+                entry = evtQ->queue.begin;
+            }
+# if (1U == OPT_KERNEL_EVT_VALUE)
+
+            if (TRUE == isValue) {                                              /* Preskoci lokaciju sa vrednoscu.                          */
+
+                if (entry != evtQ->queue.end) {
+                    ++entry;
+                } else {
+                    entry = evtQ->queue.begin;
+                }
+            }
+# endif
+        }
+    }
+#endif
+
+    return (old);
+}
+
 /*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
 /*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
 
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE) && (1U == OPT_KERNEL_EVTQ_POW2)
+# error "Kernel configuration: OPT_KERNEL_EVTQ_LOCKFREE and OPT_KERNEL_EVTQ_POW2 are mutually exclusive."
+#endif
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+# if !defined(__STDC_VERSION__) || (__STDC_VERSION__ < 201112L) || defined(__STDC_NO_ATOMICS__)
+#  error "Kernel configuration: OPT_KERNEL_EVTQ_LOCKFREE requires a C11 compiler with <stdatomic.h>."
+# endif
+#endif
+
 /** @endcond *//** @} *//******************************************************
  * END of evtq.c
  ******************************************************************************/
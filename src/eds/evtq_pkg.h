@@ -34,6 +34,10 @@
 
 #include "primitive/queue.h"
 
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+# include <stdatomic.h>
+#endif
+
 /*===============================================================  MACRO's  ==*/
 
 /**
@@ -42,6 +46,28 @@
 #define EVTQ_RANGE_SIZE(size)                                                   \
     ((size) >= 1)
 
+#if (1U == OPT_KERNEL_EVT_VALUE) || defined(__DOXYGEN__)
+/**
+ * @brief       Oznaka lokacije reda koja sadrzi dogadjaj po vrednosti
+ * @details     Dogadjaji su uvek poravnati, pa je najnizi bit pokazivaca na
+ *              dogadjaj nula. Lokacija sa postavljenim najnizim bitom u ostalim
+ *              bitima nosi identifikator dogadjaja po vrednosti.
+ */
+# define EVTQ_VALUE_TAG                 ((uintptr_t)1U)
+
+/**
+ * @brief       Kodira identifikator dogadjaja po vrednosti u lokaciju reda
+ */
+# define EVTQ_VALUE_ENCODE(id)                                                  \
+    ((esEvt_T *)(((uintptr_t)(id) << 1U) | EVTQ_VALUE_TAG))
+
+/**
+ * @brief       Da li lokacija reda sadrzi dogadjaj po vrednosti
+ */
+# define EVTQ_IS_VALUE(entry)                                                   \
+    (0U != ((uintptr_t)(entry) & EVTQ_VALUE_TAG))
+#endif
+
 /*------------------------------------------------------  C++ extern begin  --*/
 #if defined(__cplusplus)
 extern "C" {
@@ -49,59 +75,387 @@ extern "C" {
 
 /*============================================================  DATA TYPES  ==*/
 
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE) || defined(__DOXYGEN__)
 /**
- * @brief       Red cekanja za dogadjaje.
- * @details     Ova struktura opisuje redove cekanja za dogadjaje koji se
- *              koriste za aktivne objekte. Red cekanja zajedno sa
- *              procesorom konacnih automata (SMP) cini jedan agent za obradu
- *              dogadjaja, (Event Processing Agent - EPA).
- *
- *              Struktura sadrzi samo podatke za upravljanje reda cekanja i ne
- *              sadrzi memorijski prostor za cuvanje dogadjaja. Memorijski
- *              prostor se mora rezervisati unapred i predati pokazivac na taj
- *              prostor EVT-u prilikom inicijalizacije reda cekanja.
- *
- *              U redovima cekanja se cuvaju samo pokazivaci ka dogadjajima, a
- *              ne i same instance dogadjaja.
- *
- *              Pored navedenog reda za cekanje, struktura moze da sadrzi
- *              brojace zauzeca reda za cekanje. @ref free pokazuje trenutni
- *              broj praznih lokacija dok @ref freeMin sadrzi najmanji broj
- *              slobodnih lokacija ikada.
- * @notapi
+ * @brief       Lokacija lock-free reda za cekanje
+ * @details     Sekvenca odredjuje stanje lokacije: kada je jednaka poziciji
+ *              upisa lokacija je slobodna za upis, kada je za jedan veca od
+ *              pozicije citanja u lokaciji se nalazi dogadjaj.
  */
-typedef struct evtQueue {
+struct evtQSlot {
 /**
- * @brief       Instanca reda za cekanje opste namene
+ * @brief       Sekvenca lokacije
  */
-    esQp_T          queue;
+    atomic_size_t   seq;
 
-#if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
 /**
- * @brief       Trenutni broj slobodnih lokacija u redu za cekanje
+ * @brief       Dogadjaj smesten u lokaciju
  */
-    uint_fast8_t    free;
+    esEvt_T *       evt;
 
+#if (1U == OPT_KERNEL_EVT_VALUE) || defined(__DOXYGEN__)
 /**
- * @brief       Najmanji broj slobodnih lokacija u redu za cekanje
+ * @brief       Vrednost dogadjaja po vrednosti
  */
-    uint_fast8_t    freeMin;
+    uintptr_t       value;
+#endif
+};
 #endif
-} evtQueue_T;
+
+/**
+ * @brief       Red cekanja za dogadjaje
+ * @details     Struktura je definisana u javnom interfejsu jer je EPA objekat
+ *              sadrzi.
+ */
+typedef struct evtQueue evtQueue_T;
 
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
+#if (1U == OPT_KERNEL_EVT_VALUE) || defined(__DOXYGEN__)
+/**
+ * @brief       Popunjava dogadjaj po vrednosti procitan iz reda
+ * @param       entry                   Lokacija reda sa identifikatorom,
+ * @param       value                   vrednost dogadjaja,
+ * @param       [out] storage           struktura koja se popunjava.
+ * @return      Pokazivac na zaglavlje popunjene strukture.
+ * @details     Dogadjaj se oznacava kao konstantan, tako da ga brojac
+ *              korisnika i esEvtDestroyI() ne menjaju.
+ */
+static PORT_C_INLINE_ALWAYS esEvt_T * evtQValueDecode_(
+    esEvt_T *       entry,
+    uintptr_t       value,
+    esEvtValue_T *  storage) {
+
+    storage->super.id = (esEvtId_T)((uintptr_t)entry >> 1U);
+    storage->super.attrib = EVT_CONST_Msk | EVT_VALUE_Msk;
+#if (1 == CFG_EVT_USE_SIZE)
+    storage->super.size = (esEvtSize_T)sizeof(esEvtValue_T);
+#endif
+#if (2 > CFG_EVT_STORAGE)
+    storage->super.pool = NULL;
+#endif
+#if (1 == CFG_DBG_API_VALIDATION)
+    storage->super.signature = EVT_SIGNATURE;
+#endif
+    storage->value = value;
+
+    return (&storage->super);
+}
+#endif
+
+#if (1U == OPT_KERNEL_EVTQ_LOCKFREE)
+
+/**
+ * @brief       Ispituje da li u redu postoji upisan dogadjaj na pocetku reda
+ * @details     Lokacija koju je proizvodjac zauzeo ali jos nije upisao se
+ *              smatra praznom. Tada se postavlja @c isStalled, pa se sekvenca
+ *              lokacije ponovo cita kako proizvodjac koji je u medjuvremenu
+ *              zavrsio upis ne bi promasio budjenje. Poziva se unutar kriticne
+ *              sekcije.
+ */
+static PORT_C_INLINE_ALWAYS bool_T evtQIsEmptyI_(
+    evtQueue_T *    evtQ) {
+
+    struct evtQSlot * slot;
+    bool_T answer;
+
+    answer = FALSE;
+    slot = &evtQ->slot[evtQ->head & evtQ->mask];
+
+    if (0U == atomic_load_explicit(&evtQ->count, memory_order_acquire)) {
+        answer = TRUE;
+    } else if ((evtQ->head + 1U) == atomic_load_explicit(&slot->seq, memory_order_acquire)) {
+
+        if (TRUE == atomic_load_explicit(&evtQ->isStalled, memory_order_relaxed)) {
+            atomic_store_explicit(
+                &evtQ->isStalled,
+                FALSE,
+                memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit(                                                  /* Proizvodjac jos upisuje lokaciju na pocetku reda.        */
+            &evtQ->isStalled,
+            TRUE,
+            memory_order_seq_cst);
+
+        if ((evtQ->head + 1U) != atomic_load_explicit(&slot->seq, memory_order_seq_cst)) {
+            answer = TRUE;
+        }
+    }
+
+    return (answer);
+}
+
+static PORT_C_INLINE_ALWAYS bool_T evtQIsFullI_(
+    evtQueue_T *    evtQ) {
+
+    bool_T answer;
+
+    if (evtQ->mask < atomic_load_explicit(&evtQ->count, memory_order_relaxed)) {
+        answer = TRUE;
+    } else {
+        answer = FALSE;
+    }
+
+    return (answer);
+}
+
+/**
+ * @brief       Vraca lokaciju na pocetku reda
+ * @details     Poziva se samo kada je evtQIsEmptyI_() vratila FALSE, pa je
+ *              lokacija vec upisana i ne ceka se na proizvodjaca.
+ */
+static PORT_C_INLINE_ALWAYS struct evtQSlot * evtQSlotHeadI_(
+    evtQueue_T *    evtQ) {
+
+    return (&evtQ->slot[evtQ->head & evtQ->mask]);
+}
+
+/**
+ * @brief       Vraca procitanu lokaciju proizvodjacima
+ */
+static PORT_C_INLINE_ALWAYS void evtQSlotReleaseI_(
+    evtQueue_T *    evtQ,
+    struct evtQSlot * slot) {
+
+    atomic_store_explicit(
+        &slot->seq,
+        evtQ->head + evtQ->mask + 1U,
+        memory_order_release);
+    evtQ->head++;
+    atomic_fetch_sub_explicit(
+        &evtQ->count,
+        1U,
+        memory_order_release);
+}
+
+/**
+ * @brief       Dobavlja dogadjaj iz reda
+ * @details     Poziva je samo dispecer, unutar kriticne sekcije i samo kada
+ *              red nije prazan.
+ */
+static PORT_C_INLINE_ALWAYS esEvt_T * evtQGetI_(
+    evtQueue_T *    evtQ) {
+
+    struct evtQSlot * slot;
+    esEvt_T * evt;
+
+    slot = evtQSlotHeadI_(
+        evtQ);
+    evt = slot->evt;
+    evtQSlotReleaseI_(
+        evtQ,
+        slot);
+
+    return (evt);
+}
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+/**
+ * @brief       Dobavlja dogadjaj iz reda koji moze sadrzati dogadjaje po
+ *              vrednosti
+ * @param       evtQ                    Pokazivac na red za cekanje,
+ * @param       [out] storage           struktura u koju se smesta dogadjaj po
+ *                                      vrednosti.
+ * @return      Pokazivac na dogadjaj ili na zaglavlje u @c storage.
+ * @details     Poziva je samo dispecer, unutar kriticne sekcije i samo kada
+ *              red nije prazan.
+ */
+static PORT_C_INLINE_ALWAYS esEvt_T * evtQGetValueI_(
+    evtQueue_T *    evtQ,
+    esEvtValue_T *  storage) {
+
+    struct evtQSlot * slot;
+    esEvt_T * evt;
+
+    slot = evtQSlotHeadI_(
+        evtQ);
+    evt = slot->evt;
+
+    if (EVTQ_IS_VALUE(evt)) {                                                   /* Vrednost se cita pre nego sto se lokacija oslobodi.      */
+        evt = evtQValueDecode_(
+            evt,
+            slot->value,
+            storage);
+    }
+    evtQSlotReleaseI_(
+        evtQ,
+        slot);
+
+    return (evt);
+}
+#endif
+
+/**
+ * @brief       Upisuje lokaciju u red bez kriticne sekcije
+ * @param       evtQ                    Pokazivac na red za cekanje,
+ * @param       evt                     dogadjaj koji se upisuje,
+ * @param       value                   vrednost dogadjaja po vrednosti,
+ * @param       [out] wasEmpty          TRUE ukoliko je ovaj upis povecao broj
+ *                                      dogadjaja sa nule ili je dispecer
+ *                                      zatekao neupisanu lokaciju, pa EPA
+ *                                      objekat treba probuditi.
+ * @return      Da li je dogadjaj upisan
+ *  @retval     TRUE - dogadjaj je upisan,
+ *  @retval     FALSE - red je pun.
+ * @details     Moze se pozvati iz bilo kog konteksta i sa bilo kog jezgra.
+ */
+static PORT_C_INLINE_ALWAYS bool_T evtQSlotPut_(
+    evtQueue_T *    evtQ,
+    esEvt_T *       evt,
+    uintptr_t       value,
+    bool_T *        wasEmpty) {
+
+    struct evtQSlot * slot;
+    size_t pos;
+    bool_T answer;
+    bool_T isPending;
+
+    answer = FALSE;
+    isPending = TRUE;
+    pos = atomic_load_explicit(
+        &evtQ->tail,
+        memory_order_relaxed);
+
+    while (TRUE == isPending) {
+        ptrdiff_t diff;
+
+        slot = &evtQ->slot[pos & evtQ->mask];
+        diff = (ptrdiff_t)(atomic_load_explicit(&slot->seq, memory_order_acquire) - pos);
+
+        if (0 == diff) {                                                        /* Lokacija je slobodna, pokusaj da je zauzmes.             */
+
+            if (atomic_compare_exchange_weak_explicit(&evtQ->tail, &pos, pos + 1U,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                isPending = FALSE;
+                answer = TRUE;
+            }
+        } else if (0 > diff) {                                                  /* Red je pun.                                              */
+            isPending = FALSE;
+        } else {                                                                /* Drugi proizvodjac je zauzeo lokaciju.                    */
+            pos = atomic_load_explicit(
+                &evtQ->tail,
+                memory_order_relaxed);
+        }
+    }
+
+    if (TRUE == answer) {
+        size_t occupied;
+
+        slot->evt = evt;
+#if (1U == OPT_KERNEL_EVT_VALUE)
+        slot->value = value;
+#else
+        (void)value;
+#endif
+        atomic_store_explicit(                                                  /* Uparuje se sa isStalled u evtQIsEmptyI_().               */
+            &slot->seq,
+            pos + 1U,
+            memory_order_seq_cst);
+        occupied = atomic_fetch_add_explicit(
+            &evtQ->count,
+            1U,
+            memory_order_acq_rel);
+
+        if (0U == occupied) {
+            *wasEmpty = TRUE;
+        } else if (TRUE == atomic_load_explicit(&evtQ->isStalled, memory_order_seq_cst)) {
+            *wasEmpty = TRUE;
+        } else {
+            *wasEmpty = FALSE;
+        }
+
+#if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
+        {
+            size_t free;
+            size_t freeMin;
+
+            free = evtQ->mask - occupied;
+            freeMin = atomic_load_explicit(
+                &evtQ->freeMin,
+                memory_order_relaxed);
+
+            while ((free < freeMin) &&
+                !atomic_compare_exchange_weak_explicit(&evtQ->freeMin, &freeMin, free,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                /* Ponovi dok se ne upise manja vrednost. */
+            }
+        }
+#endif
+    }
+
+    return (answer);
+}
+
+/**
+ * @brief       Upisuje dogadjaj u red bez kriticne sekcije
+ * @see         evtQSlotPut_()
+ */
+static PORT_C_INLINE_ALWAYS bool_T evtQPut_(
+    evtQueue_T *    evtQ,
+    esEvt_T *       evt,
+    bool_T *        wasEmpty) {
+
+    return (evtQSlotPut_(evtQ, evt, 0U, wasEmpty));
+}
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+/**
+ * @brief       Upisuje dogadjaj po vrednosti u red bez kriticne sekcije
+ * @details     Identifikator i vrednost zauzimaju jednu lokaciju reda.
+ * @see         evtQSlotPut_()
+ */
+static PORT_C_INLINE_ALWAYS bool_T evtQPutValue_(
+    evtQueue_T *    evtQ,
+    esEvtId_T       id,
+    uintptr_t       value,
+    bool_T *        wasEmpty) {
+
+    return (evtQSlotPut_(evtQ, EVTQ_VALUE_ENCODE(id), value, wasEmpty));
+}
+#endif
+
+static PORT_C_INLINE_ALWAYS void evtQPutI_(
+    evtQueue_T *    evtQ,
+    esEvt_T *       evt) {
+
+    bool_T wasEmpty;
+
+    (void)evtQPut_(
+        evtQ,
+        evt,
+        &wasEmpty);
+}
+
+#else /* (1U == OPT_KERNEL_EVTQ_LOCKFREE) */
+
+#if (1U == OPT_KERNEL_EVTQ_POW2)
+# define EVTQ_IS_EMPTY_(queue)          esQpPow2IsEmpty_(queue)
+# define EVTQ_IS_FULL_(queue)           esQpPow2IsFull_(queue)
+# define EVTQ_GET_(queue)               esQpPow2Get_(queue)
+# define EVTQ_PUT_(queue, item)         esQpPow2Put_(queue, item)
+# define EVTQ_PUT_AHEAD_(queue, item)   esQpPow2PutAhead_(queue, item)
+# define EVTQ_FREE_SPACE_(queue)        esQpPow2FreeSpace_(queue)
+#else
+# define EVTQ_IS_EMPTY_(queue)          esQpIsEmpty_(queue)
+# define EVTQ_IS_FULL_(queue)           esQpIsFull_(queue)
+# define EVTQ_GET_(queue)               esQpGet_(queue)
+# define EVTQ_PUT_(queue, item)         esQpPut_(queue, item)
+# define EVTQ_PUT_AHEAD_(queue, item)   esQpPutAhead_(queue, item)
+# define EVTQ_FREE_SPACE_(queue)        (esQpFreeSpace_(queue) - 1U)            /* Jedna lokacija esQp_T reda je uvek prazna.               */
+#endif
+
 static PORT_C_INLINE_ALWAYS bool_T evtQIsEmptyI_(
     evtQueue_T *    evtQ) {
 
-    return (esQpIsEmpty_(&evtQ->queue));
+    return (EVTQ_IS_EMPTY_(&evtQ->queue));
 }
 
 static PORT_C_INLINE_ALWAYS bool_T evtQIsFullI_(
     evtQueue_T *    evtQ) {
 
-    return (esQpIsFull_(&evtQ->queue));
+    return (EVTQ_IS_FULL_(&evtQ->queue));
 }
 
 static PORT_C_INLINE_ALWAYS esEvt_T * evtQGetI_(
@@ -109,7 +463,7 @@ static PORT_C_INLINE_ALWAYS esEvt_T * evtQGetI_(
 
     esEvt_T * evt;
 
-    evt = esQpGet_(
+    evt = EVTQ_GET_(
         &evtQ->queue);
 
 #if (OPT_LOG_LEVEL <= LOG_INFO) || defined(__DOXYGEN__)
@@ -123,7 +477,7 @@ static PORT_C_INLINE_ALWAYS void evtQPutAheadI_(
     evtQueue_T *    evtQ,
     esEvt_T *       evt) {
 
-    esQpPutAhead_(
+    EVTQ_PUT_AHEAD_(
         &evtQ->queue,
         evt);
 
@@ -139,7 +493,7 @@ static PORT_C_INLINE_ALWAYS void evtQPutI_(
     evtQueue_T *    evtQ,
     esEvt_T *       evt) {
 
-    esQpPut_(
+    EVTQ_PUT_(
         &evtQ->queue,
         evt);
 
@@ -151,6 +505,99 @@ static PORT_C_INLINE_ALWAYS void evtQPutI_(
 #endif
 }
 
+/**
+ * @brief       Dobavlja broj slobodnih lokacija reda
+ */
+static PORT_C_INLINE_ALWAYS size_t evtQFreeI_(
+    evtQueue_T *    evtQ) {
+
+    return (EVTQ_FREE_SPACE_(&evtQ->queue));
+}
+
+#if (1U == OPT_KERNEL_EVT_VALUE)
+/**
+ * @brief       Da li u red moze da se upise dogadjaj po vrednosti
+ */
+static PORT_C_INLINE_ALWAYS bool_T evtQHasValueRoomI_(
+    evtQueue_T *    evtQ) {
+
+    bool_T answer;
+
+    if (2U <= EVTQ_FREE_SPACE_(&evtQ->queue)) {
+        answer = TRUE;
+    } else {
+        answer = FALSE;
+    }
+
+    return (answer);
+}
+
+/**
+ * @brief       Upisuje dogadjaj po vrednosti u red
+ * @details     Identifikator i vrednost zauzimaju dve uzastopne lokacije reda.
+ *              Pozivalac proverava evtQHasValueRoomI_() pre poziva.
+ */
+static PORT_C_INLINE_ALWAYS void evtQPutValueI_(
+    evtQueue_T *    evtQ,
+    esEvtId_T       id,
+    uintptr_t       value) {
+
+    evtQPutI_(
+        evtQ,
+        EVTQ_VALUE_ENCODE(id));
+    evtQPutI_(
+        evtQ,
+        (esEvt_T *)value);
+}
+
+/**
+ * @brief       Upisuje dogadjaj po vrednosti na pocetak reda
+ * @details     Vrednost se upisuje prva kako bi identifikator bio ispred nje.
+ *              Pozivalac proverava evtQHasValueRoomI_() pre poziva.
+ */
+static PORT_C_INLINE_ALWAYS void evtQPutValueAheadI_(
+    evtQueue_T *    evtQ,
+    esEvtId_T       id,
+    uintptr_t       value) {
+
+    evtQPutAheadI_(
+        evtQ,
+        (esEvt_T *)value);
+    evtQPutAheadI_(
+        evtQ,
+        EVTQ_VALUE_ENCODE(id));
+}
+
+/**
+ * @brief       Dobavlja dogadjaj iz reda koji moze sadrzati dogadjaje po
+ *              vrednosti
+ * @param       evtQ                    Pokazivac na red za cekanje,
+ * @param       [out] storage           struktura u koju se smesta dogadjaj po
+ *                                      vrednosti.
+ * @return      Pokazivac na dogadjaj ili na zaglavlje u @c storage.
+ */
+static PORT_C_INLINE_ALWAYS esEvt_T * evtQGetValueI_(
+    evtQueue_T *    evtQ,
+    esEvtValue_T *  storage) {
+
+    esEvt_T * evt;
+
+    evt = evtQGetI_(
+        evtQ);
+
+    if (EVTQ_IS_VALUE(evt)) {
+        evt = evtQValueDecode_(
+            evt,
+            (uintptr_t)evtQGetI_(evtQ),
+            storage);
+    }
+
+    return (evt);
+}
+#endif
+
+#endif /* !(1U == OPT_KERNEL_EVTQ_LOCKFREE) */
+
 /**
  * @brief       Inicijalizije red za cekanje
  * @param       [out] evtQ              Pokazivac na red za cekanje
@@ -160,7 +607,7 @@ static PORT_C_INLINE_ALWAYS void evtQPutI_(
 void evtQInit(
     evtQueue_T *    evtQ,
     esEvt_T **      evtQBuff,
-    uint8_t         size);
+    size_t          size);
 
 /**
  * @brief       Deinicijalizuje red za cekanje
@@ -169,15 +616,42 @@ void evtQInit(
 void evtQDeInit(
     evtQueue_T *    evtQ);
 
+/**
+ * @brief       Zamenjuje dogadjaj u redu dogadjajem istog identifikatora
+ * @param       evtQ                    Pokazivac na red za cekanje,
+ * @param       evt                     nov dogadjaj.
+ * @return      Dogadjaj koji je zamenjen ili NULL ukoliko u redu nema
+ *              dogadjaja sa identifikatorom <code>evt->id</code>.
+ * @details     Red se pretrazuje od pocetka, pa se menja dogadjaj koji ceka
+ *              najduze. Dogadjaji po vrednosti se preskacu. Kod lock-free reda
+ *              preskacu se i lokacije koje proizvodjac jos upisuje. Poziva se
+ *              unutar kriticne sekcije, brojace korisnika menja pozivalac.
+ */
+esEvt_T * evtQReplaceI(
+    evtQueue_T *    evtQ,
+    esEvt_T *       evt);
+
 /**
  * @brief       Kolika je potrebna velicina bafera za cuvanje @c levels
  *              dogadjaja?
  * @param       [in] levels             Koliko dogadjaja treba da se smesti u
  *                                      bafer?
  * @return      Velicinu bafera u bajtovima.
+ * @details     Broj lokacija se zaokruzuje pomocu evtQCapacity().
  */
 size_t evtQReqSize(
-    uint8_t         levels);
+    size_t          levels);
+
+/**
+ * @brief       Koliko dogadjaja stvarno moze da se smesti u red za cekanje
+ *              koji je trazen za @c levels dogadjaja?
+ * @param       [in] levels             Trazeni broj dogadjaja
+ * @return      Kod redova velicine stepena dvojke (@ref OPT_KERNEL_EVTQ_POW2
+ *              i @ref OPT_KERNEL_EVTQ_LOCKFREE) prvi stepen dvojke koji nije
+ *              manji od @c levels, inace @c levels.
+ */
+size_t evtQCapacity(
+    size_t          levels);
 
 /*--------------------------------------------------------  C++ extern end  --*/
 #if defined(__cplusplus)
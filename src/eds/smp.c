@@ -54,7 +54,7 @@
  *                                      dogadjaj.
  */
 #define SM_SIGNAL_SEND(sm, state, evt)                                         \
-    (*state)(((sm) + 1U), (esEvt_T *)&esEvtSignal[evt])
+    (*state)((sm), (esEvt_T *)&evtSignal[evt])
 
 /**
  * @brief       Posalji dogadjaj @c evt automatu @c hsm.
@@ -64,17 +64,73 @@
  *                                      dogadjaj.
  */
 #define SM_EVT_SEND(sm, state, evt)                                             \
-    (*state)(((sm) + 1U), (evt))
+    (*state)((sm), (evt))
+
+/**
+ * @brief       Sazima adresu funkcije stanja u kljuc kesa
+ * @param       state                   Funkcija stanja.
+ * @details     Funkcije su poravnate (na racunaru obicno na 16 bajtova), pa
+ *              bi najnizi bitovi adrese uvek bili isti. Visi bitovi se zato
+ *              presavijaju preko nizih.
+ */
+#define TRAN_CACHE_KEY(state)                                                   \
+    ((uintptr_t)(state) ^ ((uintptr_t)(state) >> 4U) ^ ((uintptr_t)(state) >> 8U))
+
+/**
+ * @brief       Izracunava red kesa za tranziciju iz @c src u @c dst
+ * @param       cache                   Pokazivac na kes putanja tranzicija,
+ * @param       src                     izvorisno stanje,
+ * @param       dst                     odredisno stanje.
+ * @details     Kljuc odredista se pomera da tranzicije A -> B i B -> A ne bi
+ *              uvek pale u isti red.
+ */
+#define TRAN_CACHE_IDX(cache, src, dst)                                         \
+    ((uint_fast16_t)((TRAN_CACHE_KEY(src) ^ (TRAN_CACHE_KEY(dst) >> 1U)) % (cache)->size))
+
+/**
+ * @brief       Da li stanje iz tabele hijerarhije obradjuje dogadjaj @c id
+ * @param       desc                    Pokazivac na opis stanja,
+ * @param       id                      identifikator dogadjaja.
+ */
+#if (1U == OPT_SMP_STATE_MASK)
+# define STATE_HANDLES(desc, id)                                                \
+    ((ES_SM_MASK_BITS <= (id)) || (0U != ((desc)->mask & ES_SM_SIG(id))))
+#else
+# define STATE_HANDLES(desc, id)                                                \
+    (TRUE)
+#endif
+
+/**
+ * @brief       Broji jedan preskocen poziv funkcije stanja automata @c sm
+ */
+#if (1U == OPT_SMP_STATE_MASK)
+# define STATE_SKIPPED(sm)                                                      \
+    (sm)->skipped++
+#else
+# define STATE_SKIPPED(sm)                                                      \
+    (void)0
+#endif
 
 /*======================================================  LOCAL DATA TYPES  ==*/
 /*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
 
-#if (OPT_SMP_SM_TYPES != ES_SMP_FSM_ONLY)
-
-static esState_T * disTranFindPath(
+#if (OPT_SMP_SM_TYPES == ES_SMP_HSM_ONLY) || (OPT_SMP_SM_TYPES == ES_SMP_FSM_AND_HSM)
+#if (1U == OPT_SMP_TRAN_CACHE)
+static esState_T * hsmTranCachePath(
     esSm_T *        sm,
     esState_T *     exit,
     esState_T *     entry);
+#endif
+
+#if (1U == OPT_SMP_STATE_TABLE)
+static uint_fast8_t stateTableIdx(
+    const PORT_C_ROM esSmStateTable_T * stateTable,
+    esState_T       state);
+
+static esStatus_T hsmTableDispatch(
+    esSm_T *        sm,
+    const esEvt_T * evt);
+#endif
 
 static void hsmTranEnter(
     esSm_T *        sm,
@@ -94,114 +150,47 @@ static void hsmTranExit(
  * @brief       Tabela signalnih dogadjaja
  */
 const PORT_C_ROM esEvt_T evtSignal[] = {
-    {(esEvtId_T)SIG_EMPTY,
-    EVT_RESERVED_Msk | EVT_CONST_Msk,
-#if (1U == CFG_EVT_USE_TIMESTAMP)
-    0U,
-#endif
-#if defined(CFG_EVT_USE_GENERATOR)
-    NULL,
-#endif
-#if (1U == CFG_EVT_USE_SIZE)
-    0U,
-#endif
-#if (1U == CFG_DBG_API_VALIDATION)
-    EVT_SIGNATURE
+    [SIG_EMPTY] = {
+        .id = (esEvtId_T)SIG_EMPTY,
+        .attrib = EVT_RESERVED_Msk | EVT_CONST_Msk,
+#if (1 == CFG_DBG_API_VALIDATION)
+        .signature = EVT_SIGNATURE
 #endif
-
-    [SIG_ENTRY].id = SIG_ENTRY,
-    [SIG_ENTRY].dynamic = {
-        .s = {
-            .counter = 0U,
-            .attrib = EVT_CONST_Msk
-        }
     },
-    {(esEvtId_T)SIG_ENTRY,
-    EVT_RESERVED_Msk | EVT_CONST_Msk,
-#if (1U == CFG_EVT_USE_TIMESTAMP)
-    0U,
-#endif
-#if (1U == CFG_EVT_USE_GENERATOR)
-    NULL,
-#endif
-#if (1U == CFG_EVT_USE_SIZE)
-    0U,
+    [SIG_ENTRY] = {
+        .id = (esEvtId_T)SIG_ENTRY,
+        .attrib = EVT_RESERVED_Msk | EVT_CONST_Msk,
+#if (1 == CFG_DBG_API_VALIDATION)
+        .signature = EVT_SIGNATURE
 #endif
-#if (1U == CFG_DBG_API_VALIDATION)
-    EVT_SIGNATURE
-#endif
-
-    [SIG_EXIT].id = SIG_EXIT,
-    [SIG_EXIT].dynamic = {
-        .s = {
-            .counter = 0U,
-            .attrib = EVT_CONST_Msk
-        }
     },
-    {(esEvtId_T)SIG_EXIT,
-    EVT_RESERVED_Msk | EVT_CONST_Msk,
-#if (1U == CFG_EVT_USE_TIMESTAMP)
-    0U,
-#endif
-#if (1U == CFG_EVT_USE_GENERATOR)
-    NULL,
+    [SIG_EXIT] = {
+        .id = (esEvtId_T)SIG_EXIT,
+        .attrib = EVT_RESERVED_Msk | EVT_CONST_Msk,
+#if (1 == CFG_DBG_API_VALIDATION)
+        .signature = EVT_SIGNATURE
 #endif
-#if (1U == CFG_EVT_USE_SIZE)
-    0U,
-#endif
-#if (1U == CFG_DBG_API_VALIDATION)
-    EVT_SIGNATURE
-#endif
-
-    [SIG_INIT].id = SIG_INIT,
-    [SIG_INIT].dynamic = {
-        .s = {
-            .counter = 0U,
-            .attrib = EVT_CONST_Msk
-        }
     },
-    {(esEvtId_T)SIG_INIT,
-    EVT_RESERVED_Msk | EVT_CONST_Msk,
-#if (1U == CFG_EVT_USE_TIMESTAMP)
-    0U,
-#endif
-#if (1U == CFG_EVT_USE_GENERATOR)
-    NULL,
+    [SIG_INIT] = {
+        .id = (esEvtId_T)SIG_INIT,
+        .attrib = EVT_RESERVED_Msk | EVT_CONST_Msk,
+#if (1 == CFG_DBG_API_VALIDATION)
+        .signature = EVT_SIGNATURE
 #endif
-#if (1U == CFG_EVT_USE_SIZE)
-    0U,
-#endif
-#if (1U == CFG_DBG_API_VALIDATION)
-    EVT_SIGNATURE
-#endif
-
-    [SIG_SUPER].id = SIG_SUPER,
-    [SIG_SUPER].dynamic = {
-        .s = {
-            .counter = 0U,
-            .attrib = EVT_CONST_Msk
-        }
     },
-    {(esEvtId_T)SIG_SUPER,
-    EVT_RESERVED_Msk | EVT_CONST_Msk,
-#if (1U == CFG_EVT_USE_TIMESTAMP)
-    0U,
-#endif
-#if (1U == CFG_EVT_USE_GENERATOR)
-    NULL,
-#endif
-#if (1U == CFG_EVT_USE_SIZE)
-    0U,
-#endif
-#if (1U == CFG_DBG_API_VALIDATION)
-    EVT_SIGNATURE
+    [SIG_SUPER] = {
+        .id = (esEvtId_T)SIG_SUPER,
+        .attrib = EVT_RESERVED_Msk | EVT_CONST_Msk,
+#if (1 == CFG_DBG_API_VALIDATION)
+        .signature = EVT_SIGNATURE
 #endif
+    }
 };
 #pragma GCC diagnostic pop
 
 /*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
 
-#if (OPT_SMP_SM_TYPES != ES_SMP_FSM_ONLY)
+#if (OPT_SMP_SM_TYPES == ES_SMP_HSM_ONLY) || (OPT_SMP_SM_TYPES == ES_SMP_FSM_AND_HSM)
 
 /**
  * @brief       Pronalazi putanju od izvorista do odredista
@@ -281,20 +270,257 @@ static esState_T * hsmTranFindPath(
         *(++exit) = sm->state;
         entry = sm->stateQEnd;
 
-        while (&esSmTopState != **entry) {
+        while ((*exit != *entry) && (&esSmTopState != **entry)) {               /* Zajednicki predak moze biti i esSmTopState,              */
+                                                                                /* koji je poslednji u redu stanja za ulaz.                 */
+            --entry;
+        }
 
-            if (*exit == *entry) {
-                *exit = (esState_T)0U;
+        if (*exit == *entry) {
+            *exit = (esState_T)0U;
 
-                return (entry);
-            }
-            --entry;
+            return (entry);
         }
     }
 
     return ((esState_T *)0U);
 }
 
+#if (1U == OPT_SMP_TRAN_CACHE)
+/**
+ * @brief       Pronalazi putanju od izvorista do odredista koristeci kes
+ * @param       [in,out] sm             Pokazivac na automat
+ * @param       [in,out] exit           Pokazivac na pocetak reda stanja za izlaz
+ * @param       [in,out] entry          Pokazivac na kraj reda stanja za ulaz
+ * @return      Pokazivac na pocetak reda stanja za ulaz.
+ * @details     Redovi stanja se popunjavaju isto kao u hsmTranFindPath(). Kada
+ *              par (izvoriste, odrediste) postoji u kesu, putanja se kopira iz
+ *              kesa bez slanja SIG_SUPER signala, a inace se trazi funkcijom
+ *              hsmTranFindPath() i upisuje u kes. Kes dele svi automati iste
+ *              definicije, pa se redovi kesa citaju i pisu u kriticnoj sekciji.
+ * @notapi
+ */
+static esState_T * hsmTranCachePath(
+    esSm_T *        sm,
+    esState_T *     exit,
+    esState_T *     entry) {
+
+    esSmTranCache_T * cache;
+    struct esSmTranLine * line;
+    esState_T *     path;
+    esState_T *     begin;
+    esState_T       src;
+    esState_T       dst;
+    uint_fast16_t   idx;
+    uint_fast8_t    cnt;
+    bool_T          isHit;
+    PORT_CRITICAL_DECL;
+
+    cache = sm->tranCache;
+
+    if (NULL == cache) {
+
+        return (hsmTranFindPath(sm, exit, entry));
+    }
+    src = *exit;
+    dst = *entry;
+    idx = TRAN_CACHE_IDX(cache, src, dst);
+    line = &cache->line[idx];
+    path = &cache->path[(size_t)idx * cache->levels * 2U];
+    begin = entry;
+    isHit = FALSE;
+    PORT_CRITICAL_ENTER();
+
+    if ((src == line->src) && (dst == line->dst)) {
+        isHit = TRUE;
+        cache->hit++;
+
+        for (cnt = 0U; cnt < line->nExit; cnt++) {
+            exit[cnt] = path[cnt];
+        }
+        exit[cnt] = (esState_T)0U;
+        begin = entry - line->nEntry;
+
+        for (cnt = 0U; cnt < line->nEntry; cnt++) {
+            begin[cnt + 1U] = path[line->nExit + cnt];
+        }
+    } else {
+        cache->miss++;
+    }
+    PORT_CRITICAL_EXIT();
+
+    if (FALSE == isHit) {
+        uint_fast8_t nExit;
+        uint_fast8_t nEntry;
+
+        begin = hsmTranFindPath(
+            sm,
+            exit,
+            entry);
+        nExit = 0U;
+
+        while ((esState_T)0U != exit[nExit]) {
+            nExit++;
+        }
+        nEntry = (uint_fast8_t)(entry - begin);
+
+        if ((nExit + nEntry) <= (cache->levels * 2U)) {                         /* Putanja je duza od kesa ako su dubine razlicite.         */
+            PORT_CRITICAL_ENTER();
+            line->src = src;
+            line->dst = dst;
+            line->nExit = (uint8_t)nExit;
+            line->nEntry = (uint8_t)nEntry;
+
+            for (cnt = 0U; cnt < nExit; cnt++) {
+                path[cnt] = exit[cnt];
+            }
+
+            for (cnt = 0U; cnt < nEntry; cnt++) {
+                path[nExit + cnt] = begin[cnt + 1U];
+            }
+            PORT_CRITICAL_EXIT();
+        }
+    }
+
+    return (begin);
+}
+#endif
+
+#if (1U == OPT_SMP_STATE_TABLE)
+/**
+ * @brief       Pronalazi indeks stanja u tabeli hijerarhije
+ * @param       [in] stateTable         Pokazivac na tabelu hijerarhije,
+ * @param       [in] state              funkcija stanja koja se trazi.
+ * @return      Indeks stanja ili broj stanja u tabeli ako stanje nije u tabeli.
+ * @notapi
+ */
+static uint_fast8_t stateTableIdx(
+    const PORT_C_ROM esSmStateTable_T * stateTable,
+    esState_T       state) {
+
+    uint_fast8_t    idx;
+
+    idx = 0U;
+
+    while ((idx < stateTable->size) && (state != stateTable->state[idx].handler)) {
+        idx++;
+    }
+
+    return (idx);
+}
+
+/**
+ * @brief       Dispecer HSM automata sa tabelom hijerarhije stanja
+ * @param       [in] sm                 Pokazivac na strukturu HSM automata
+ * @param       [in] evt                Dogadjaj koji treba da se obradi
+ * @return      Status obrade dogadjaja.
+ * @details     Putanje tranzicija se racunaju preko roditelja i dubina iz
+ *              tabele, bez SIG_SUPER signala i bez reda stanja. Kada je opcija
+ *              @ref OPT_SMP_STATE_MASK ukljucena dogadjaj se salje samo
+ *              stanjima cija maska sadrzi njegov identifikator. Izlaz i ulaz u
+ *              stanja su isti kao kod hsmTranFindPath(): najblizi zajednicki
+ *              predak (LCA) se ne napusta, a tranzicija u samo stanje ili u
+ *              direktno podstanje napusta izvoriste (slucajevi a) i b)).
+ * @notapi
+ */
+static esStatus_T hsmTableDispatch(
+    esSm_T *        sm,
+    const esEvt_T * evt) {
+
+    const PORT_C_ROM struct esSmStateDesc * desc;
+    uint_fast8_t    curr;
+    uint_fast8_t    src;
+    esStatus_T      status;
+
+    desc = sm->stateTable->state;
+    curr = sm->stateIdx;
+    src = curr;
+    status = RETN_SUPER;
+
+    while (RETN_SUPER == status) {
+
+        while ((ES_SM_TOP_IDX != src) && (FALSE == STATE_HANDLES(&desc[src], evt->id))) {
+            src = desc[src].parent;                                             /* Prema maski stanje bi vratilo RETN_SUPER.                */
+            STATE_SKIPPED(sm);
+        }
+
+        if (FALSE != STATE_HANDLES(&desc[src], evt->id)) {
+            status = SM_EVT_SEND(sm, desc[src].handler, (esEvt_T *)evt);
+
+            if (RETN_SUPER == status) {
+                src = desc[src].parent;
+            }
+        } else {                                                                /* Ni jedno stanje ne obradjuje dogadjaj.                   */
+            STATE_SKIPPED(sm);
+            status = RETN_IGNORED;
+        }
+    }
+
+    while (RETN_TRAN == status) {
+        uint_fast8_t dst;
+        uint_fast8_t exitTo;
+        uint_fast8_t enterFrom;
+        uint_fast8_t level;
+
+        dst = stateTableIdx(
+            sm->stateTable,
+            sm->state);
+
+        if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
+            ES_LOG_DBG_IF_INVALID(&gKernelLog, dst < sm->stateTable->size, LOG_SM_DISPATCH, ES_ARG_NOT_VALID);
+        }
+
+        if ((src == dst) || (src == desc[dst].parent)) {                        /* tran: a) i b)                                            */
+            exitTo = desc[src].parent;
+            enterFrom = desc[dst].parent;
+        } else {                                                                /* tran: c) - g) najblizi zajednicki predak                 */
+            uint_fast8_t srcAnc;
+            uint_fast8_t dstAnc;
+
+            srcAnc = src;
+            dstAnc = dst;
+
+            while (desc[srcAnc].depth > desc[dstAnc].depth) {
+                srcAnc = desc[srcAnc].parent;
+            }
+
+            while (desc[dstAnc].depth > desc[srcAnc].depth) {
+                dstAnc = desc[dstAnc].parent;
+            }
+
+            while (srcAnc != dstAnc) {
+                srcAnc = desc[srcAnc].parent;
+                dstAnc = desc[dstAnc].parent;
+            }
+            exitTo = srcAnc;
+            enterFrom = srcAnc;
+        }
+
+        while (curr != exitTo) {
+            (void)SM_SIGNAL_SEND(sm, desc[curr].handler, SIG_EXIT);
+            curr = desc[curr].parent;
+        }
+
+        for (level = desc[enterFrom].depth + 1U; level <= desc[dst].depth; level++) {
+            uint_fast8_t entry;
+
+            entry = dst;
+
+            while (level != desc[entry].depth) {                                /* Ulaz ide od vrha, a tabela ima samo veze ka roditelju.   */
+                entry = desc[entry].parent;
+            }
+            (void)SM_SIGNAL_SEND(sm, desc[entry].handler, SIG_ENTRY);
+        }
+        curr = dst;
+        src = dst;
+        status = (esStatus_T)SM_SIGNAL_SEND(sm, desc[dst].handler, SIG_INIT);
+    }
+    sm->stateIdx = (uint8_t)curr;
+    sm->state = desc[curr].handler;
+
+    return (status);
+}
+#endif
+
 /**
  * @brief       Ulaz u hijerarhiju
  * @param       [in] sm                 Pokazivac na konacni automat
@@ -339,17 +565,74 @@ void smInit (
     esSm_T *        sm,
     esState_T       initState,
     esState_T *     stateQueue,
-    size_t          levels) {
+    size_t          levels,
+    esSmTranCache_T * tranCache,
+    const PORT_C_ROM esSmStateTable_T * stateTable,
+    const PORT_C_ROM esSmTable_T * table) {
 
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)
+    if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, NULL != table, LOG_SM_INIT, ES_ARG_NULL);
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, table->init < table->states, LOG_SM_INIT, ES_ARG_OUT_OF_RANGE);
+    }
+#else
     if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
         ES_LOG_DBG_IF_INVALID(&gKernelLog, NULL != initState, LOG_SM_INIT, ES_ARG_NULL);
         ES_LOG_DBG_IF_INVALID(&gKernelLog, levels >= 2U, LOG_SM_INIT, ES_ARG_OUT_OF_RANGE);
     }
+    (void)table;
+#endif
+
+#if (1U == OPT_SMP_TRAN_CACHE)
+    if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, (NULL == tranCache) || (levels <= tranCache->levels), LOG_SM_INIT, ES_ARG_OUT_OF_RANGE);
+    }
+    sm->tranCache = tranCache;
+#else
+    (void)tranCache;
+#endif
+
+#if (1U == OPT_SMP_STATE_MASK)
+    sm->skipped = 0U;
+#endif
+
+#if (1U == OPT_SMP_STATE_TABLE)
+    sm->stateTable = stateTable;
+
+    if (NULL != stateTable) {
+        sm->stateIdx = (uint8_t)stateTableIdx(
+            stateTable,
+            initState);
+
+        if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
+            uint_fast8_t idx;
+
+            ES_LOG_DBG_IF_INVALID(&gKernelLog, sm->stateIdx < stateTable->size, LOG_SM_INIT, ES_ARG_NOT_VALID);
+
+            for (idx = 1U; idx < stateTable->size; idx++) {
+                const PORT_C_ROM struct esSmStateDesc * desc;
+
+                desc = &stateTable->state[idx];
+                ES_LOG_DBG_IF_INVALID(&gKernelLog, desc->parent < idx, LOG_SM_INIT, ES_ARG_NOT_VALID);
+                ES_LOG_DBG_IF_INVALID(&gKernelLog, desc->depth == (stateTable->state[desc->parent].depth + 1U), LOG_SM_INIT, ES_ARG_NOT_VALID);
+                (void)desc;                                                     /* Provere ne postoje kada je log iskljucen.                */
+            }
+        }
+    }
+#else
+    (void)stateTable;
+#endif
 
 #if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
     (void)stateQueue;
     (void)levels;
     sm->state = initState;
+#elif (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)
+    (void)stateQueue;
+    (void)levels;
+    sm->state = initState;
+    sm->table = table;
+    sm->stateIdx = table->init;
 #elif (OPT_SMP_SM_TYPES == ES_SMP_HSM_ONLY)
     sm->state = initState;
     sm->stateQBegin = stateQueue;
@@ -368,6 +651,13 @@ void smInit (
     }
 #endif
 
+#if (1U == OPT_SMP_STATE_TABLE)
+    if (NULL != stateTable) {                                                   /* Automat sa tabelom nema red stanja.                      */
+        sm->stateQBegin = (esState_T *)0U;
+        sm->stateQEnd = (esState_T *)0U;
+    }
+#endif
+
 #if (OPT_LOG_LEVEL <= LOG_DBG)
     sm->signature = SM_SIGNATURE;
 #endif
@@ -379,6 +669,9 @@ void smDeInit(
 
 #if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
     sm->state = (esState_T)0U;
+#elif (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)
+    sm->state = (esState_T)0U;
+    sm->table = (const PORT_C_ROM esSmTable_T *)0U;
 #elif (OPT_SMP_SM_TYPES == ES_SMP_HSM_ONLY)
     sm->state = (esState_T)0U;
     sm->stateQBegin = (esState_T *)0U;
@@ -390,6 +683,14 @@ void smDeInit(
     sm->stateQEnd = (esState_T *)0;
 #endif
 
+#if (1U == OPT_SMP_TRAN_CACHE)
+    sm->tranCache = (esSmTranCache_T *)0U;
+#endif
+
+#if (1U == OPT_SMP_STATE_TABLE)
+    sm->stateTable = (const PORT_C_ROM esSmStateTable_T *)0U;
+#endif
+
 #if (OPT_LOG_LEVEL <= LOG_DBG)
     sm->signature = (uint16_t)~SM_SIGNATURE;
 #endif
@@ -397,9 +698,19 @@ void smDeInit(
 
 /*----------------------------------------------------------------------------*/
 size_t stateQReqSize(
-    uint8_t         levels) {
+    uint8_t         levels,
+    const PORT_C_ROM esSmStateTable_T * stateTable) {
 
-#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY)
+#if (1U == OPT_SMP_STATE_TABLE)
+    if (NULL != stateTable) {
+
+        return (0U);
+    }
+#else
+    (void)stateTable;
+#endif
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_ONLY) || (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)
     (void)levels;
 
     return (0U);
@@ -427,11 +738,17 @@ esStatus_T hsmDispatch(
     esSm_T *        sm,
     const esEvt_T * evt) {
 
-#if (OPT_SMP_SM_TYPES != ES_SMP_FSM_ONLY)
+#if (OPT_SMP_SM_TYPES == ES_SMP_HSM_ONLY) || (OPT_SMP_SM_TYPES == ES_SMP_FSM_AND_HSM)
 
     esState_T * stateQCurr;
     esStatus_T status;
 
+#if (1U == OPT_SMP_STATE_TABLE)
+    if (NULL != sm->stateTable) {
+
+        return (hsmTableDispatch(sm, evt));
+    }
+#endif
     stateQCurr = sm->stateQBegin;
     *sm->stateQEnd = sm->state;
 
@@ -444,10 +761,17 @@ esStatus_T hsmDispatch(
 
     while (RETN_TRAN == status) {
         *sm->stateQEnd = sm->state;
+#if (1U == OPT_SMP_TRAN_CACHE)
+        stateQCurr = hsmTranCachePath(
+            sm,
+            stateQCurr,
+            sm->stateQEnd);
+#else
         stateQCurr = hsmTranFindPath(
             sm,
             stateQCurr,
             sm->stateQEnd);
+#endif
         hsmTranExit(
             sm,
             sm->stateQBegin);
@@ -493,6 +817,43 @@ esStatus_T fsmDispatch(
     return (status);
 }
 
+/*----------------------------------------------------------------------------*/
+esStatus_T tfsmDispatch(
+    esSm_T *        sm,
+    const esEvt_T * evt) {
+
+#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_TABLE)
+    const PORT_C_ROM esSmTable_T * table;
+    esStatus_T status;
+
+    table = sm->table;
+    status = RETN_IGNORED;
+
+    if (evt->id < table->signals) {
+        const PORT_C_ROM struct esSmTableCell * cell;
+
+        cell = &table->cell[((size_t)sm->stateIdx * table->signals) + evt->id];
+
+        if (NULL != cell->action) {
+            (*cell->action)(sm, evt);
+            status = RETN_HANDLED;
+        }
+
+        if (0U != cell->next) {
+            sm->stateIdx = cell->next - 1U;
+            status = RETN_HANDLED;
+        }
+    }
+
+    return (status);
+#else
+    (void)sm;
+    (void)evt;
+
+    return (RETN_IGNORED);
+#endif
+}
+
 /*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
 
 /*------------------------------------------------------------------------*//**
@@ -505,10 +866,10 @@ esStatus_T esRetnTransition(
 
     if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
         ES_LOG_DBG_IF_INVALID(&gKernelLog, NULL != sm, LOG_SM_RETN_TRAN, ES_ARG_NULL);
-        ES_LOG_DBG_IF_INVALID(&gKernelLog, SM_SIGNATURE == ((esSm_T *)sm - 1U)->signature, LOG_SM_RETN_TRAN, ES_ARG_NOT_VALID);
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, SM_SIGNATURE == ((esSm_T *)sm)->signature, LOG_SM_RETN_TRAN, ES_ARG_NOT_VALID);
     }
 
-    ((esSm_T *)sm - 1U)->state = state;
+    ((esSm_T *)sm)->state = state;
 
     return (RETN_TRAN);
 }
@@ -537,10 +898,10 @@ esStatus_T esRetnSuper(
 
     if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
         ES_LOG_DBG_IF_INVALID(&gKernelLog, NULL != sm, LOG_SM_RETN_SUPER, ES_ARG_NULL);
-        ES_LOG_DBG_IF_INVALID(&gKernelLog, SM_SIGNATURE == ((esSm_T *)sm - 1U)->signature, LOG_SM_RETN_SUPER, ES_ARG_NOT_VALID);
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, SM_SIGNATURE == ((esSm_T *)sm)->signature, LOG_SM_RETN_SUPER, ES_ARG_NOT_VALID);
     }
 
-    ((esSm_T *)sm - 1U)->state = state;
+    ((esSm_T *)sm)->state = state;
 
     return (RETN_SUPER);
 }
@@ -576,27 +937,28 @@ esSm_T * esSmCreate(
         PORT_DATA_ALIGNMENT);
     stateQSize = GP_ALIGN(
         stateQReqSize(
-            definition->smLevels),
+            definition->smLevels,
+            definition->smStateTable),
         PORT_DATA_ALIGNMENT);
 
-#if (OPT_MM_DISTRIBUTION == ES_MM_STATIC_ONLY)
-    (void)memClass;
+#if (OPT_MM_DISTRIBUTION == ES_MM_DYNAMIC_ONLY)
     {
         PORT_CRITICAL_DECL;
 
+        (void)memClass;
         PORT_CRITICAL_ENTER();
-        newSm = esSMemAllocI(
+        newSm = OPT_MEM_DYN_ALLOCI(
+            OPT_MEM_DYN_HANDLE,
             smpSize + stateQSize);
         PORT_CRITICAL_EXIT();
     }
-#elif (OPT_MM_DISTRIBUTION == ES_MM_DYNAMIC_ONLY)
-    (void)memClass;
+#elif (OPT_MM_DISTRIBUTION == ES_MM_STATIC_ONLY)
     {
         PORT_CRITICAL_DECL;
 
-        PORT_CRITICAL_ENTER(
-            OPT_KERNEL_INTERRUPT_PRIO_MAX);
-        newSm = esDmemAllocI(
+        (void)memClass;
+        PORT_CRITICAL_ENTER();
+        newSm = esSmemAllocI(
             smpSize + stateQSize);
         PORT_CRITICAL_EXIT();
     }
@@ -604,14 +966,14 @@ esSm_T * esSmCreate(
     newSm = (* memClass->alloc)(smpSize + stateQSize);
     *((const PORT_C_ROM struct memClass **)newSm) = memClass;
 #endif
-    newSm = mmObjCreate(
-        memClass,
-        smpSize + stateQSize);
     smInit(
         newSm,
         definition->smInitState,
-        (esState_T *)(newSm + smpSize),
-        definition->smLevels);
+        (esState_T *)((uint8_t *)newSm + smpSize),
+        definition->smLevels,
+        definition->smTranCache,
+        definition->smStateTable,
+        definition->smTable);
 
     return (newSm);
 }
@@ -635,7 +997,8 @@ void esSmDestroy(
         PORT_CRITICAL_DECL;
 
         PORT_CRITICAL_ENTER();
-        esDmemDeAllocI(
+        OPT_MEM_DYN_DEALLOCI(
+            OPT_MEM_DYN_HANDLE,
             sm);
         PORT_CRITICAL_EXIT();
     }
@@ -644,6 +1007,117 @@ void esSmDestroy(
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+void esSmTranCacheStatusGet(
+    const esSmTranCache_T * cache,
+    esSmTranCacheStatus_T * status) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    status->hit = cache->hit;
+    status->miss = cache->miss;
+    PORT_CRITICAL_EXIT();
+}
+
+/*----------------------------------------------------------------------------*/
+uint32_t esSmSkippedGet(
+    const esSm_T *  sm) {
+
+#if (1U == OPT_SMP_STATE_MASK)
+    if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, NULL != sm, LOG_SM_DISPATCH, ES_ARG_NULL);
+    }
+
+    return (sm->skipped);
+#else
+    (void)sm;
+
+    return (0U);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+void esSmPoolInit(
+    esSmPool_T *    pool,
+    const PORT_C_ROM esSmTable_T * table,
+    uint8_t *       state,
+    void *          data,
+    size_t          dataSize,
+    uint32_t        size) {
+
+    uint32_t        idx;
+
+    if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, (NULL != pool) && (NULL != table) && (NULL != state), LOG_SM_INIT, ES_ARG_NULL);
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, (NULL != data) || (0U == dataSize), LOG_SM_INIT, ES_ARG_NULL);
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, table->init < table->states, LOG_SM_INIT, ES_ARG_OUT_OF_RANGE);
+    }
+    pool->table = table;
+    pool->state = state;
+    pool->data = (uint8_t *)data;
+    pool->dataSize = dataSize;
+    pool->size = size;
+
+    for (idx = 0U; idx < size; idx++) {
+        state[idx] = table->init;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+uint32_t esSmPoolDispatch(
+    esSmPool_T *    pool,
+    const uint32_t * indices,
+    uint32_t        count,
+    const esEvt_T * evt) {
+
+    const PORT_C_ROM struct esSmTableCell * column;
+    uint8_t *       state;
+    uint8_t *       data;
+    size_t          dataSize;
+    uint_fast8_t    signals;
+    uint32_t        handled;
+    uint32_t        cnt;
+
+    if (ES_LOG_IS_DBG(&gKernelLog, LOG_FILT_SMP)) {
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, (NULL != pool) && (NULL != evt), LOG_SM_DISPATCH, ES_ARG_NULL);
+        ES_LOG_DBG_IF_INVALID(&gKernelLog, (NULL != indices) || (count <= pool->size), LOG_SM_DISPATCH, ES_ARG_OUT_OF_RANGE);
+    }
+    handled = 0U;
+
+    if (evt->id >= pool->table->signals) {                                      /* Dogadjaj ignorisu svi automati.                          */
+
+        return (handled);
+    }
+    column = &pool->table->cell[evt->id];
+    signals = pool->table->signals;
+    state = pool->state;
+    data = pool->data;
+    dataSize = pool->dataSize;
+
+    for (cnt = 0U; cnt < count; cnt++) {
+        const PORT_C_ROM struct esSmTableCell * cell;
+        uint32_t    idx;
+
+        idx = (NULL != indices) ? indices[cnt] : cnt;
+        cell = &column[(size_t)state[idx] * signals];
+
+        if (NULL != cell->action) {
+            (*cell->action)(&data[(size_t)idx * dataSize], evt);
+        }
+
+        if (0U != cell->next) {
+            state[idx] = cell->next - 1U;
+        }
+
+        if ((NULL != cell->action) || (0U != cell->next)) {
+            handled++;
+        }
+    }
+
+    return (handled);
+}
+
 /*----------------------------------------------------------------------------*/
 void esSmpInit(
     void) {
@@ -40,6 +40,9 @@
 #elif (OPT_SMP_SM_TYPES == 2)
 # define SM_DISPATCH(sm, evt)                                                   \
     hsmDispatch(sm, evt)
+#elif (OPT_SMP_SM_TYPES == 4)
+# define SM_DISPATCH(sm, evt)                                                   \
+    tfsmDispatch(sm, evt)
 #else
 # define SM_DISPATCH(sm, evt)                                                   \
     (*(sm)->dispatch)(sm, evt)
@@ -55,69 +58,6 @@ extern "C" {
 
 extern const PORT_C_ROM esEvt_T evtSignal[];
 
-/**
- * @brief       Pristigli dogadjaj nije obradjen i ignorisan je.
- * @details     Obicno se ovakav odgovor u top state-u automata i koristi se u
- *              svrhe debagiranja sistema. Dogadjaj se brise iz sistema ako nema
- *              jos korisnika.
- */
-    RETN_IGNORED,
-
-/**
- * @brief       Vraca se koje je super stanje date state handler funkcije.
- * @details     Ova vrednost se vraca kada state handler funkcija ne zna da
- *              obradi neki dogadjaj ili je od nje zahtevano da vrati koje je
- *              njeno super stanje.
- */
-    RETN_SUPER
-};
-
-/**
- * @details     Struktura sadrzi trenutno stanje automata. Ostali clanovi su
- *              opcioni. Ukoliko se koriste HSM automati koriste se pokazivaci
- *              na redove cekanja za stanja automata.
- * @notapi
- */
-struct esSm {
-
-#if (OPT_LOG_LEVEL <= LOG_DBG)
-/**
- * @brief       Potpis koji pokazuje da je ovo zaista SM objekat.
- */
-    uint16_t        signature;
-#endif
-
-/**
- * @brief       Pokazivac na state handler funkciju.
- * @details     Ovaj pokazivac pokazuje na funkciju stanja koja vrsi obradu
- *              dogadjaja.
- */
-    esState_T       state;
-
-#if (OPT_SMP_SM_TYPES == ES_SMP_FSM_AND_HSM)
-/**
- * @brief       Pokazivac na dispecer funkciju datog automata
- * @details     Ovaj clan strukture se koristi samo ukoliko se istovremeno
- *              koriste FSM i HSM automati.
- */
-    esStatus_T (* dispatch)(struct esSm *, const esEvt_T *);
-#endif
-
-#if (OPT_SMP_SM_TYPES != ES_SMP_FSM_ONLY) || defined(__DOXYGEN__)
-/**
- * @brief       Niz za cuvanje izvornih stanja HSM automata
- * @details     Ovaj clan se koristi samo ukoliko se koriste HSM automati.
- */
-    esState_T *     stateQBegin;
-
-/**
- * @brief       Niz za cuvanje odredisnih stanja HSM automata
- * @details     Ovaj clan se koristi samo ukoliko se koriste HSM automati.
- */
-    esState_T *     stateQEnd;
-#endif
-};
-
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
@@ -125,12 +65,15 @@ struct esSm {
  * @brief       Vraca kolika je potrebna velicina memorijskog prostora za
  *              cuvanje bafera stanja.
  * @param       levels                  Maksimalna hijerarhijska dubina stanja
- *                                      automata.
+ *                                      automata,
+ * @param       stateTable              tabela hijerarhije stanja ili NULL.
  * @return      Potreban memorijski prostor u bajtovima.
+ * @details     Automat sa tabelom hijerarhije stanja ne koristi red stanja.
  * @notapi
  */
 size_t stateQReqSize(
-    uint8_t         levels);
+    uint8_t         levels,
+    const PORT_C_ROM esSmStateTable_T * stateTable);
 
 /**
  * @brief       Dispecer HSM automata
@@ -152,6 +95,16 @@ esStatus_T fsmDispatch(
     esSm_T *        sm,
     const esEvt_T * evt);
 
+/**
+ * @brief       Dispecer FSM automata zadatog tabelom prelaza
+ * @param       [in] sm                 Pokazivac na strukturu FSM automata
+ * @param       [in] evt                Dogadjaj koji treba da se obradi
+ * @return      Status obrade dogadjaja.
+ */
+esStatus_T tfsmDispatch(
+    esSm_T *        sm,
+    const esEvt_T * evt);
+
 /**
  * @brief       Konstruise automat
  * @param       [out] sm                Pokazivac na tek kreiranu strukturu
@@ -159,13 +112,25 @@ esStatus_T fsmDispatch(
  * @param       [in] initState          inicijalno stanje automata,
  * @param       [in] stateQueue         pokazivac na memorijski bafer za stanja,
  * @param       [in] levels             maksimalna hijerarhijska dubina stanja
- *                                      automata.
+ *                                      automata,
+ * @param       [in] tranCache          kes putanja tranzicija ili NULL. Koristi
+ *                                      se samo kada je opcija
+ *                                      @ref OPT_SMP_TRAN_CACHE ukljucena,
+ * @param       [in] stateTable         tabela hijerarhije stanja ili NULL.
+ *                                      Koristi se samo kada je opcija
+ *                                      @ref OPT_SMP_STATE_TABLE ukljucena,
+ * @param       [in] table              tabela prelaza. Koristi se samo kada je
+ *                                      @ref OPT_SMP_SM_TYPES jednako
+ *                                      @ref ES_SMP_FSM_TABLE.
  */
 void smInit (
     esSm_T *        sm,
     esState_T       initState,
     esState_T *     stateQueue,
-    size_t          levels);
+    size_t          levels,
+    esSmTranCache_T * tranCache,
+    const PORT_C_ROM esSmStateTable_T * stateTable,
+    const PORT_C_ROM esSmTable_T * table);
 
 /**
  * @brief       Dekonstruise automat
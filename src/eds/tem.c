@@ -0,0 +1,518 @@
+/******************************************************************************
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementacija Time Event Management (TEM) modula
+ * @addtogroup  tem_impl
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#define TEM_PKG_H_VAR
+#include "eds_private.h"
+#include "eds/common.h"
+#include "arch/cpu.h"
+#include "../config/kernel_config.h"
+
+#if (1U == OPT_TEM_ENABLE) || defined(__DOXYGEN__)
+/*=========================================================  LOCAL DEFINES  ==*/
+
+/**
+ * @brief       Konstanta za potpis vremenskog dogadjaja
+ */
+#define TIMEEVT_SIGNATURE               (0xDEEDU)
+
+/**
+ * @brief       Broj bita tika koji se razresava na jednom nivou tocka
+ */
+#define TEM_SLOTS_PWR                   OPT_TEM_WHEEL_SLOTS_PWR
+
+/**
+ * @brief       Broj lokacija na jednom nivou tocka
+ */
+#define TEM_SLOTS                       (1U << TEM_SLOTS_PWR)
+
+/**
+ * @brief       Maska lokacije unutar jednog nivoa tocka
+ */
+#define TEM_SLOT_MASK                   ((esTick_T)TEM_SLOTS - 1U)
+
+/**
+ * @brief       Broj nivoa tocka
+ */
+#define TEM_LEVELS                      OPT_TEM_WHEEL_LEVELS
+
+/**
+ * @brief       Najvece kasnjenje koje tocak pokriva bez ponovnog razvrstavanja
+ */
+#define TEM_RANGE                       ((esTick_T)1U << (TEM_SLOTS_PWR * TEM_LEVELS))
+
+/**
+ * @brief       Najvece kasnjenje koje se moze zadati vremenskom dogadjaju
+ */
+#define TEM_DELAY_MAX                   ((esTick_T)~(esTick_T)0U >> 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**
+ * @brief       Broj bita tika ispod nivoa @c lvl
+ */
+#define TEM_LVL_SHIFT(lvl)              ((lvl) * TEM_SLOTS_PWR)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static PORT_C_INLINE void temWheelInsertI_(
+    esTimeEvt_T *   timeEvt);
+
+static PORT_C_INLINE void temWheelRmI_(
+    esTimeEvt_T *   timeEvt);
+
+static void temWheelCascadeI(
+    esDlsList_T *   slot);
+
+static void temWheelExpireI(
+    esDlsList_T *   slot);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+/**
+ * @brief       Hijerarhijski tocak vremenskih dogadjaja
+ * @details     Nivo @c lvl pokriva kasnjenja od
+ *              <code>TEM_SLOTS ^ lvl</code> do
+ *              <code>TEM_SLOTS ^ (lvl + 1) - 1</code> tikova. Lokacija
+ *              vremenskog dogadjaja na nivou se odredjuje bitima apsolutnog
+ *              trenutka isteka, pa naoruzavanje i razoruzavanje zahtevaju samo
+ *              ubacivanje u DLS listu, odnosno izbacivanje iz nje.
+ */
+static esDlsList_T gTemWheel[TEM_LEVELS][TEM_SLOTS];
+
+/**
+ * @brief       Brojac sistemskih tikova
+ */
+static esTick_T gTemNow;
+
+/**
+ * @brief       Da li su periodicni sistemski tikovi zaustavljeni
+ */
+static bool_T gTemIsSuppressed;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+/**
+ * @brief       Ubacuje vremenski dogadjaj u tocak
+ * @param       timeEvt                Vremenski dogadjaj ciji je trenutak
+ *                                      isteka vec izracunat.
+ * @details     Nivo se odredjuje najvisim postavljenim bitom preostalog
+ *              vremena, a lokacija bitima trenutka isteka tog nivoa. Vremenski
+ *              dogadjaj cije je preostalo vreme van opsega tocka se smesta u
+ *              poslednju lokaciju najviseg nivoa i ponovo se razvrstava kada
+ *              ona dodje na red.
+ */
+static PORT_C_INLINE void temWheelInsertI_(
+    esTimeEvt_T *   timeEvt) {
+
+    esTick_T place;
+    esTick_T diff;
+    uint_fast8_t lvl;
+
+    place = timeEvt->expire;
+    diff  = place - gTemNow;
+
+    if (TEM_RANGE <= diff) {
+        diff  = TEM_RANGE - 1U;
+        place = gTemNow + diff;
+    }
+
+    if (0U == diff) {                                                           /* Istice u ovom tiku, nakon razvrstavanja visih nivoa.     */
+        lvl = 0U;
+    } else {
+        lvl = (uint_fast8_t)(PORT_FIND_LAST_SET((portReg_T)diff) / TEM_SLOTS_PWR);
+    }
+    esDlsNodeAddTail_(
+        &gTemWheel[lvl][(place >> TEM_LVL_SHIFT(lvl)) & TEM_SLOT_MASK],
+        &timeEvt->list);
+}
+
+/**
+ * @brief       Izbacuje vremenski dogadjaj iz tocka
+ * @param       timeEvt                Vremenski dogadjaj koji je u tocku.
+ */
+static PORT_C_INLINE void temWheelRmI_(
+    esTimeEvt_T *   timeEvt) {
+
+    esDlsNodeRm_(
+        &timeEvt->list);
+    esDlsNodeInit_(
+        &timeEvt->list);
+}
+
+/**
+ * @brief       Razvrstava vremenske dogadjaje iz lokacije viseg nivoa u nize
+ *              nivoe
+ * @param       slot                   Lokacija koja je dosla na red.
+ * @details     Svaki vremenski dogadjaj se razvrstava najvise jednom po nivou,
+ *              tako da je ukupna cena po vremenskom dogadjaju ogranicena
+ *              brojem nivoa. Ponovo ubaceni vremenski dogadjaj nikada ne
+ *              zavrsava u istoj lokaciji.
+ */
+static void temWheelCascadeI(
+    esDlsList_T *   slot) {
+
+    while (FALSE == esDlsIsEmpty_(slot)) {
+        esTimeEvt_T * timeEvt;
+
+        timeEvt = ES_DLS_NODE_ENTRY(
+            esTimeEvt_T,
+            list,
+            slot->next);
+        temWheelRmI_(
+            timeEvt);
+        temWheelInsertI_(
+            timeEvt);
+    }
+}
+
+/**
+ * @brief       Salje dogadjaje svih vremenskih dogadjaja iz lokacije nivoa 0
+ * @param       slot                   Lokacija trenutnog tika.
+ * @details     Periodicni vremenski dogadjaji se ponovo naoruzavaju pre slanja
+ *              dogadjaja, tako da perioda ne zavisi od kasnjenja obrade. Kada
+ *              tocak ima samo jedan nivo, u lokaciji se mogu naci i vremenski
+ *              dogadjaji cije vreme jos nije isteklo, pa se oni samo ponovo
+ *              razvrstavaju.
+ */
+static void temWheelExpireI(
+    esDlsList_T *   slot) {
+
+    while (FALSE == esDlsIsEmpty_(slot)) {
+        esTimeEvt_T * timeEvt;
+
+        timeEvt = ES_DLS_NODE_ENTRY(
+            esTimeEvt_T,
+            list,
+            slot->next);
+        temWheelRmI_(
+            timeEvt);
+
+        if (gTemNow != timeEvt->expire) {                                       /* Kasnjenje van opsega tocka sa jednim nivoom.             */
+            temWheelInsertI_(
+                timeEvt);
+
+            continue;
+        }
+
+        if (0U != timeEvt->period) {
+            timeEvt->expire += timeEvt->period;
+            temWheelInsertI_(
+                timeEvt);
+        }
+        esEvtPostI(
+            timeEvt->epa,
+            timeEvt->evt);
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+
+/*----------------------------------------------------------------------------*/
+void temInit(
+    void) {
+
+    uint_fast8_t lvl;
+
+    for (lvl = 0U; lvl < TEM_LEVELS; lvl++) {
+        uint_fast16_t slot;
+
+        for (slot = 0U; slot < TEM_SLOTS; slot++) {
+            esDlsSentinelInit_(
+                &gTemWheel[lvl][slot]);
+        }
+    }
+    gTemNow = 0U;
+    gTemIsSuppressed = FALSE;
+}
+
+/*----------------------------------------------------------------------------*/
+esTick_T temNextExpireI(
+    void) {
+
+    esTick_T next;
+    uint_fast8_t lvl;
+
+    next = 0U;
+
+    for (lvl = 0U; lvl < TEM_LEVELS; lvl++) {
+        esTick_T base;
+        esTick_T cnt;
+
+        base = gTemNow >> TEM_LVL_SHIFT(lvl);
+
+        for (cnt = 1U; cnt <= TEM_SLOTS; cnt++) {                              /* Lokacije se obilaze redom kojim dolaze na red.           */
+
+            if (FALSE == esDlsIsEmpty_(&gTemWheel[lvl][(base + cnt) & TEM_SLOT_MASK])) {
+                esTick_T ticks;
+
+                ticks = ((base + cnt) << TEM_LVL_SHIFT(lvl)) - gTemNow;
+
+                if ((0U == next) || (ticks < next)) {
+                    next = ticks;
+                }
+
+                break;
+            }
+        }
+    }
+
+    return (next);
+}
+
+/*----------------------------------------------------------------------------*/
+void temSuppressI(
+    void) {
+
+#if defined(PORT_SYSTMR_SUPPRESS)
+    PORT_SYSTMR_SUPPRESS(
+        temNextExpireI());
+    gTemIsSuppressed = TRUE;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+void temResumeI(
+    void) {
+
+#if defined(PORT_SYSTMR_SUPPRESS)
+
+    if (TRUE == gTemIsSuppressed) {
+        gTemIsSuppressed = FALSE;
+        PORT_SYSTMR_RESUME();
+    }
+#endif
+}
+
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+/*----------------------------------------------------------------------------*/
+void esTimeEvtInit(
+    esTimeEvt_T *   timeEvt,
+    esEpa_T *       epa,
+    esEvt_T *       evt) {
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != timeEvt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != epa);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != evt);
+
+    esDlsNodeInit_(
+        &timeEvt->list);
+    timeEvt->expire = 0U;
+    timeEvt->period = 0U;
+    timeEvt->epa = epa;
+    timeEvt->evt = evt;
+
+    if (0U == (EVT_CONST_Msk & evt->attrib)) {                                 /* Dinamicki dogadjaj se salje vise puta.                   */
+        esEvtReserve(
+            evt);
+    }
+    ES_KERN_API_OBLIGATION(timeEvt->signature = TIMEEVT_SIGNATURE);
+}
+
+/*----------------------------------------------------------------------------*/
+void esTimeEvtArm(
+    esTimeEvt_T *   timeEvt,
+    esTick_T        delay,
+    esTick_T        period) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    esTimeEvtArmI(
+        timeEvt,
+        delay,
+        period);
+    PORT_CRITICAL_EXIT();
+}
+
+/*----------------------------------------------------------------------------*/
+void esTimeEvtArmI(
+    esTimeEvt_T *   timeEvt,
+    esTick_T        delay,
+    esTick_T        period) {
+
+    bool_T isSuppressed;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != timeEvt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, TIMEEVT_SIGNATURE == timeEvt->signature);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, (0U < delay) && (TEM_DELAY_MAX >= delay));
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, TEM_DELAY_MAX >= period);
+
+    if (TRUE == esTimeEvtIsArmed(timeEvt)) {
+        temWheelRmI_(
+            timeEvt);
+    }
+    isSuppressed = gTemIsSuppressed;
+    temResumeI();                                                               /* Nadoknadjuje propustene tikove pre racunanja isteka.     */
+    timeEvt->expire = gTemNow + delay;
+    timeEvt->period = period;
+    temWheelInsertI_(
+        timeEvt);
+
+    if (TRUE == isSuppressed) {                                                 /* Sva jezgra spavaju, tajmer se samo programira za novi    */
+        temSuppressI();                                                         /* istek, koji moze biti pre zakazanog prekida.             */
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+bool_T esTimeEvtDisarm(
+    esTimeEvt_T *   timeEvt) {
+
+    PORT_CRITICAL_DECL;
+    bool_T answer;
+
+    PORT_CRITICAL_ENTER();
+    answer = esTimeEvtDisarmI(
+        timeEvt);
+    PORT_CRITICAL_EXIT();
+
+    return (answer);
+}
+
+/*----------------------------------------------------------------------------*/
+bool_T esTimeEvtDisarmI(
+    esTimeEvt_T *   timeEvt) {
+
+    bool_T answer;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != timeEvt);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NOT_VALID, TIMEEVT_SIGNATURE == timeEvt->signature);
+
+    answer = esTimeEvtIsArmed(
+        timeEvt);
+
+    if (TRUE == answer) {
+        temWheelRmI_(
+            timeEvt);
+    }
+
+    return (answer);
+}
+
+/*----------------------------------------------------------------------------*/
+bool_T esTimeEvtIsArmed(
+    const esTimeEvt_T * timeEvt) {
+
+    bool_T answer;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != timeEvt);
+
+    if (&timeEvt->list != timeEvt->list.next) {
+        answer = TRUE;
+    } else {
+        answer = FALSE;
+    }
+
+    return (answer);
+}
+
+/*----------------------------------------------------------------------------*/
+void esTemTickI(
+    void) {
+
+    uint_fast8_t lvl;
+
+    gTemNow++;
+    lvl = TEM_LEVELS - 1U;
+
+    while (0U != lvl) {                                                         /* Visi nivoi se razvrstavaju pre nizih.                    */
+
+        if (0U == (gTemNow & (((esTick_T)1U << TEM_LVL_SHIFT(lvl)) - 1U))) {
+            temWheelCascadeI(
+                &gTemWheel[lvl][(gTemNow >> TEM_LVL_SHIFT(lvl)) & TEM_SLOT_MASK]);
+        }
+        lvl--;
+    }
+    temWheelExpireI(
+        &gTemWheel[0][gTemNow & TEM_SLOT_MASK]);
+}
+
+/*----------------------------------------------------------------------------*/
+void esTemTickNI(
+    esTick_T        ticks) {
+
+    while (0U != ticks) {
+        esTick_T next;
+
+        next = temNextExpireI();
+
+        if ((0U == next) || (ticks < next)) {                                   /* U preostalim tikovima nema punih lokacija.               */
+            gTemNow += ticks;
+            ticks = 0U;
+        } else {
+            gTemNow += next - 1U;                                               /* Prazne lokacije se preskacu, obradjuje se samo tik u     */
+            ticks   -= next;                                                    /* kome puna lokacija dolazi na red.                        */
+            esTemTickI();
+        }
+    }
+
+    if (TRUE == gTemIsSuppressed) {                                             /* Sva jezgra i dalje spavaju, niko drugi nece ponovo       */
+        temSuppressI();                                                         /* programirati tajmer.                                     */
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+esTick_T esTemTickGet(
+    void) {
+
+    PORT_CRITICAL_DECL;
+    esTick_T now;
+
+    PORT_CRITICAL_ENTER();
+    now = gTemNow;
+    PORT_CRITICAL_EXIT();
+
+    return (now);
+}
+
+#endif /* (1U == OPT_TEM_ENABLE) */
+/** @} *//*-------------------------------------------------------------------*/
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (1U == OPT_TEM_ENABLE)
+# if (1U > OPT_TEM_WHEEL_LEVELS) || (1U > OPT_TEM_WHEEL_SLOTS_PWR)
+#  error "Kernel configuration: TEM wheel must have at least one level and two slots."
+# endif
+
+# if defined(PORT_SYSTMR_SUPPRESS) && !defined(PORT_SYSTMR_RESUME)
+#  error "Kernel port: PORT_SYSTMR_SUPPRESS requires PORT_SYSTMR_RESUME."
+# endif
+
+# if (31U < (OPT_TEM_WHEEL_LEVELS * OPT_TEM_WHEEL_SLOTS_PWR))
+#  error "Kernel configuration: TEM wheel range must not exceed 31 bits of esTick_T."
+# endif
+#endif
+
+/** @endcond *//** @} *//******************************************************
+ * END of tem.c
+ ******************************************************************************/
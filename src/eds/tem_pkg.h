@@ -0,0 +1,94 @@
+/******************************************************************************
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Privatni interfejs Time Event Management modula.
+ * @addtogroup  tem_impl
+ *********************************************************************//** @{ */
+
+#ifndef TEM_PKG_H_
+#define TEM_PKG_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include "eds/tem.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**
+ * @brief       Inicijalizuje hijerarhijski tocak vremenskih dogadjaja
+ * @notapi
+ */
+void temInit(
+    void);
+
+/**
+ * @brief       Vraca broj tikova do prvog sledeceg isteka ili razvrstavanja
+ * @return      Broj tikova od trenutnog tika, 0 ukoliko ni jedan vremenski
+ *              dogadjaj nije naoruzan.
+ * @details     Za vremenske dogadjaje u visim nivoima tocka vraca se trenutak
+ *              razvrstavanja njihove lokacije, koji je uvek pre isteka, tako da
+ *              rezultat nikada nije kasniji od stvarnog isteka.
+ * @notapi
+ */
+esTick_T temNextExpireI(
+    void);
+
+/**
+ * @brief       Zaustavlja periodicne sistemske tikove do sledeceg isteka
+ * @details     Poziva se iz kriticne sekcije kada su sva jezgra besposlena.
+ *              Port sistemski tajmer programira tako da se sledeci prekid
+ *              desi tek za temNextExpireI() tikova, a propustene tikove
+ *              nadoknadjuje kada se tajmer ponovo pokrene.
+ * @notapi
+ */
+void temSuppressI(
+    void);
+
+/**
+ * @brief       Ponovo pokrece periodicne sistemske tikove
+ * @details     Nema efekta ukoliko tikovi nisu zaustavljeni.
+ * @notapi
+ */
+void temResumeI(
+    void);
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#if defined(__cplusplus)
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of tem_pkg.h
+ ******************************************************************************/
+#endif /* TEM_PKG_H_ */
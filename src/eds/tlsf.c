@@ -0,0 +1,475 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementacija TLSF dinamickog alokatora
+ * @addtogroup  tlsf_impl
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include "../config/sys_cfg.h"
+#include "eds/kernel.h"
+#include "eds/tlsf.h"
+#include "arch/cpu.h"
+
+/*=========================================================  LOCAL DEFINES  ==*/
+
+/**
+ * @brief       Bit zauzetosti u polju velicine bloka
+ */
+#define TLSF_BLOCK_FREE                 ((size_t)1U)
+
+/**
+ * @brief       Poravnanje velicine blokova
+ */
+#define TLSF_ALIGN                      ((size_t)1U << ES_TLSF_ALIGN_LOG2)
+
+/**
+ * @brief       Velicina zaglavlja zauzetog bloka
+ */
+#define TLSF_HDR_SIZE                   offsetof(struct esTlsfBlock, nextFree)
+
+/**
+ * @brief       Najmanji korisni prostor bloka, mora da primi veze liste
+ */
+#define TLSF_MIN_SIZE                   (sizeof(struct esTlsfBlock) - TLSF_HDR_SIZE)
+
+/**
+ * @brief       Najveci korisni prostor bloka
+ */
+#define TLSF_MAX_SIZE                                                           \
+    (((size_t)1U << OPT_MEM_TLSF_FL_MAX) - TLSF_ALIGN)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**
+ * @brief       Pronalazi poslednji postavljen bit
+ * @inline
+ */
+static PORT_C_INLINE uint_fast8_t tlsfFls_(
+    size_t              value);
+
+/**
+ * @brief       Pronalazi prvi postavljen bit
+ * @inline
+ */
+static PORT_C_INLINE uint_fast8_t tlsfFfs_(
+    uint32_t            value);
+
+/**
+ * @brief       Racuna indekse liste kojoj pripada blok date velicine
+ * @inline
+ */
+static PORT_C_INLINE void tlsfMapping_(
+    size_t              size,
+    uint_fast8_t *      fl,
+    uint_fast8_t *      sl);
+
+/**
+ * @brief       Ubacuje slobodan blok u listu njegove klase
+ * @inline
+ */
+static PORT_C_INLINE void tlsfBlockInsert_(
+    esTlsf_T *          tlsf,
+    struct esTlsfBlock * block);
+
+/**
+ * @brief       Izbacuje slobodan blok iz liste njegove klase
+ * @inline
+ */
+static PORT_C_INLINE void tlsfBlockRemove_(
+    esTlsf_T *          tlsf,
+    struct esTlsfBlock * block);
+
+/**
+ * @brief       Vraca sledeci blok u memoriji
+ * @inline
+ */
+static PORT_C_INLINE struct esTlsfBlock * tlsfBlockNext_(
+    struct esTlsfBlock * block);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+/*======================================================  GLOBAL VARIABLES  ==*/
+
+esTlsf_T DefTlsfHandle;
+
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE uint_fast8_t tlsfFls_(
+    size_t              value) {
+
+    return (PORT_FIND_LAST_SET((portReg_T)value));
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE uint_fast8_t tlsfFfs_(
+    uint32_t            value) {
+
+    return (PORT_FIND_LAST_SET((portReg_T)(value & (~value + 1U))));
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE void tlsfMapping_(
+    size_t              size,
+    uint_fast8_t *      fl,
+    uint_fast8_t *      sl) {
+
+    if (((size_t)1U << ES_TLSF_FL_SHIFT) > size) {                              /* Mali blokovi se razvrstavaju linearno.                   */
+        *fl = 0U;
+        *sl = (uint_fast8_t)(size >> ES_TLSF_ALIGN_LOG2);
+    } else {
+        uint_fast8_t    bit;
+
+        bit = tlsfFls_(
+            size);
+        *sl = (uint_fast8_t)((size >> (bit - ES_TLSF_SL_LOG2)) ^ ES_TLSF_SL_COUNT);
+        *fl = (uint_fast8_t)(bit - (ES_TLSF_FL_SHIFT - 1U));
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE void tlsfBlockInsert_(
+    esTlsf_T *          tlsf,
+    struct esTlsfBlock * block) {
+
+    uint_fast8_t        fl;
+    uint_fast8_t        sl;
+    size_t              size;
+
+    size = block->size & ~TLSF_BLOCK_FREE;
+    tlsfMapping_(
+        size,
+        &fl,
+        &sl);
+    block->prevFree = NULL;
+    block->nextFree = tlsf->free[fl][sl];
+
+    if (NULL != block->nextFree) {
+        block->nextFree->prevFree = block;
+    }
+    tlsf->free[fl][sl] = block;
+    tlsf->flBitmap |= (uint32_t)1U << fl;
+    tlsf->slBitmap[fl] |= (uint32_t)1U << sl;
+    tlsf->freeSize += size;
+    tlsf->freeBlocks++;
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE void tlsfBlockRemove_(
+    esTlsf_T *          tlsf,
+    struct esTlsfBlock * block) {
+
+    uint_fast8_t        fl;
+    uint_fast8_t        sl;
+    size_t              size;
+
+    size = block->size & ~TLSF_BLOCK_FREE;
+    tlsfMapping_(
+        size,
+        &fl,
+        &sl);
+
+    if (NULL != block->nextFree) {
+        block->nextFree->prevFree = block->prevFree;
+    }
+
+    if (NULL != block->prevFree) {
+        block->prevFree->nextFree = block->nextFree;
+    } else {
+        tlsf->free[fl][sl] = block->nextFree;
+
+        if (NULL == block->nextFree) {                                          /* Lista je ostala prazna.                                  */
+            tlsf->slBitmap[fl] &= ~((uint32_t)1U << sl);
+
+            if (0U == tlsf->slBitmap[fl]) {
+                tlsf->flBitmap &= ~((uint32_t)1U << fl);
+            }
+        }
+    }
+    tlsf->freeSize -= size;
+    tlsf->freeBlocks--;
+}
+
+/*----------------------------------------------------------------------------*/
+static PORT_C_INLINE struct esTlsfBlock * tlsfBlockNext_(
+    struct esTlsfBlock * block) {
+
+    return ((struct esTlsfBlock *)((uint8_t *)block + TLSF_HDR_SIZE + (block->size & ~TLSF_BLOCK_FREE)));
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+/*----------------------------------------------------------------------------*/
+void esTlsfInit(
+    esTlsf_T *          tlsf,
+    void *              storage,
+    size_t              storageSize) {
+
+    struct esTlsfBlock * block;
+    struct esTlsfBlock * sentinel;
+    uintptr_t           begin;
+    size_t              size;
+    uint_fast8_t        fl;
+    uint_fast8_t        sl;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != tlsf);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != storage);
+
+    tlsf->flBitmap = 0U;
+
+    for (fl = 0U; fl < ES_TLSF_FL_COUNT; fl++) {
+        tlsf->slBitmap[fl] = 0U;
+
+        for (sl = 0U; sl < ES_TLSF_SL_COUNT; sl++) {
+            tlsf->free[fl][sl] = NULL;
+        }
+    }
+    tlsf->freeSize = 0U;
+    tlsf->freeBlocks = 0U;
+    begin = ((uintptr_t)storage + (TLSF_ALIGN - 1U)) & ~(uintptr_t)(TLSF_ALIGN - 1U);
+    size = storageSize - (size_t)(begin - (uintptr_t)storage);
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_OUT_OF_RANGE, (2U * TLSF_HDR_SIZE + TLSF_MIN_SIZE) <= size);
+
+    size = (size - 2U * TLSF_HDR_SIZE) & ~(TLSF_ALIGN - 1U);                    /* Zaglavlje prvog bloka i zaglavlje granicnika.            */
+
+    if (TLSF_MAX_SIZE < size) {
+        size = TLSF_MAX_SIZE;
+    }
+    block = (struct esTlsfBlock *)begin;
+    block->prevPhys = NULL;
+    block->size = size | TLSF_BLOCK_FREE;
+    sentinel = tlsfBlockNext_(
+        block);
+    sentinel->prevPhys = block;
+    sentinel->size = 0U;                                                        /* Granicnik je uvek zauzet i nikada se ne spaja.           */
+    tlsf->size = size;
+    tlsfBlockInsert_(
+        tlsf,
+        block);
+}
+
+/*----------------------------------------------------------------------------*/
+void * esTlsfAllocI(
+    esTlsf_T *          tlsf,
+    size_t              size) {
+
+    struct esTlsfBlock * block;
+    size_t              search;
+    uint32_t            map;
+    uint_fast8_t        fl;
+    uint_fast8_t        sl;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != tlsf);
+
+    if (TLSF_MAX_SIZE < size) {
+
+        return (NULL);
+    }
+    size = (size + (TLSF_ALIGN - 1U)) & ~(TLSF_ALIGN - 1U);
+
+    if (TLSF_MIN_SIZE > size) {
+        size = TLSF_MIN_SIZE;
+    }
+    search = size;
+
+    if (((size_t)1U << ES_TLSF_FL_SHIFT) <= search) {                           /* Zaokruzi na pocetak sledece klase, svaki blok iz nje     */
+        search += ((size_t)1U << (tlsfFls_(search) - ES_TLSF_SL_LOG2)) - 1U;    /* je dovoljno veliki.                                      */
+    }
+    tlsfMapping_(
+        search,
+        &fl,
+        &sl);
+
+    if (ES_TLSF_FL_COUNT <= fl) {
+
+        return (NULL);
+    }
+    map = tlsf->slBitmap[fl] & (~(uint32_t)0U << sl);
+
+    if (0U == map) {
+        map = tlsf->flBitmap & (~(uint32_t)0U << (fl + 1U));
+
+        if (0U == map) {
+
+            return (NULL);
+        }
+        fl = tlsfFfs_(
+            map);
+        map = tlsf->slBitmap[fl];
+    }
+    sl = tlsfFfs_(
+        map);
+    block = tlsf->free[fl][sl];
+    tlsfBlockRemove_(
+        tlsf,
+        block);
+
+    if ((size + TLSF_HDR_SIZE + TLSF_MIN_SIZE) <= (block->size & ~TLSF_BLOCK_FREE)) {
+        struct esTlsfBlock * rest;
+
+        rest = (struct esTlsfBlock *)((uint8_t *)block + TLSF_HDR_SIZE + size);
+        rest->prevPhys = block;
+        rest->size = ((block->size & ~TLSF_BLOCK_FREE) - size - TLSF_HDR_SIZE) | TLSF_BLOCK_FREE;
+        tlsfBlockNext_(rest)->prevPhys = rest;
+        block->size = size;
+        tlsfBlockInsert_(
+            tlsf,
+            rest);
+    } else {
+        block->size &= ~TLSF_BLOCK_FREE;
+    }
+
+    return ((void *)((uint8_t *)block + TLSF_HDR_SIZE));
+}
+
+/*----------------------------------------------------------------------------*/
+void * esTlsfAlloc(
+    esTlsf_T *          tlsf,
+    size_t              size) {
+
+    PORT_CRITICAL_DECL;
+    void *              mem;
+
+    PORT_CRITICAL_ENTER();
+    mem = esTlsfAllocI(
+        tlsf,
+        size);
+    PORT_CRITICAL_EXIT();
+
+    return (mem);
+}
+
+/*----------------------------------------------------------------------------*/
+void esTlsfDeAllocI(
+    esTlsf_T *          tlsf,
+    void *              mem) {
+
+    struct esTlsfBlock * block;
+    struct esTlsfBlock * next;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != tlsf);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != mem);
+
+    block = (struct esTlsfBlock *)((uint8_t *)mem - TLSF_HDR_SIZE);
+
+    ES_KERN_API_REQUIRE(ES_KERN_USAGE_FAILURE, 0U == (block->size & TLSF_BLOCK_FREE));
+
+    if ((NULL != block->prevPhys) && (0U != (block->prevPhys->size & TLSF_BLOCK_FREE))) {
+        struct esTlsfBlock * prev;
+
+        prev = block->prevPhys;
+        tlsfBlockRemove_(
+            tlsf,
+            prev);
+        prev->size = (prev->size & ~TLSF_BLOCK_FREE) + TLSF_HDR_SIZE + block->size;
+        block = prev;
+        tlsfBlockNext_(block)->prevPhys = block;
+    }
+    next = tlsfBlockNext_(
+        block);
+
+    if (0U != (next->size & TLSF_BLOCK_FREE)) {
+        tlsfBlockRemove_(
+            tlsf,
+            next);
+        block->size += TLSF_HDR_SIZE + (next->size & ~TLSF_BLOCK_FREE);
+        tlsfBlockNext_(block)->prevPhys = block;
+    }
+    block->size |= TLSF_BLOCK_FREE;
+    tlsfBlockInsert_(
+        tlsf,
+        block);
+}
+
+/*----------------------------------------------------------------------------*/
+void esTlsfDeAlloc(
+    esTlsf_T *          tlsf,
+    void *              mem) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    esTlsfDeAllocI(
+        tlsf,
+        mem);
+    PORT_CRITICAL_EXIT();
+}
+
+/*----------------------------------------------------------------------------*/
+void esTlsfStatusGet(
+    esTlsf_T *          tlsf,
+    esTlsfStatus_T *    status) {
+
+    PORT_CRITICAL_DECL;
+    size_t              freeMax;
+
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != tlsf);
+    ES_KERN_API_REQUIRE(ES_KERN_ARG_NULL, NULL != status);
+
+    freeMax = 0U;
+    PORT_CRITICAL_ENTER();
+
+    if (0U != tlsf->flBitmap) {                                                 /* Najveci blok je u najvecoj nepraznoj klasi.              */
+        struct esTlsfBlock * block;
+        uint_fast8_t    fl;
+        uint_fast8_t    sl;
+
+        fl = tlsfFls_(
+            tlsf->flBitmap);
+        sl = tlsfFls_(
+            tlsf->slBitmap[fl]);
+        block = tlsf->free[fl][sl];
+
+        while (NULL != block) {
+
+            if ((block->size & ~TLSF_BLOCK_FREE) > freeMax) {
+                freeMax = block->size & ~TLSF_BLOCK_FREE;
+            }
+            block = block->nextFree;
+        }
+    }
+    status->size = tlsf->size;
+    status->freeSize = tlsf->freeSize;
+    status->freeMax = freeMax;
+    status->freeBlocks = tlsf->freeBlocks;
+    PORT_CRITICAL_EXIT();
+
+    if (0U != status->freeSize) {
+        status->fragmentation = (uint_fast16_t)(1000U - (uint_fast16_t)((1000U * (uint64_t)freeMax) / status->freeSize));
+    } else {
+        status->fragmentation = 0U;
+    }
+}
+
+/** @} *//*-------------------------------------------------------------------*/
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of tlsf.c
+ ******************************************************************************/
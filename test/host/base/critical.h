@@ -0,0 +1,58 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Host implementation of critical section locking
+ * @addtogroup  host_critical
+ *********************************************************************//** @{ */
+
+#ifndef CRITICAL_H_
+#define CRITICAL_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include "arch/cpu.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Enter critical section and save the interrupt context
+ * @param       ctx
+ *              Pointer to variable of type portReg_T which holds the context
+ */
+#define ES_CRITICAL_LOCK_ENTER(ctx)                                             \
+    do {                                                                        \
+        *(ctx) = portIntGetSet_();                                              \
+    } while (0U)
+
+/**@brief       Exit critical section and restore the interrupt context
+ * @param       ctx
+ *              Context saved by ES_CRITICAL_LOCK_ENTER()
+ */
+#define ES_CRITICAL_LOCK_EXIT(ctx)      portIntSet_(ctx)
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of critical.h
+ ******************************************************************************/
+#endif /* CRITICAL_H_ */
@@ -0,0 +1,136 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Host implementation of debug support
+ * @addtogroup  host_dbg
+ *********************************************************************//** @{ */
+
+#ifndef DBG_H_
+#define DBG_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include "arch/compiler.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Enable API contract validation
+ * @details     Possible values:
+ *              - 0 - contracts are not validated
+ *              - 1 - contracts are validated with userAssert()
+ */
+#if !defined(CFG_DBG_API_VALIDATION) || defined(__DOXYGEN__)
+# define CFG_DBG_API_VALIDATION         0
+#endif
+
+/**@brief       Declare module information
+ * @details     The host build does not keep module information, the macro
+ *              only declares an unused object so it can be followed by a
+ *              semicolon.
+ */
+#define DECL_MODULE_INFO(name, desc, auth)                                      \
+    extern const PORT_C_ROM char LocalModuleName_[]
+
+#if (1 == CFG_DBG_API_VALIDATION) || defined(__DOXYGEN__)
+
+/**@brief       Generic debug assert macro
+ * @param       num
+ *              Error number
+ * @param       expr
+ *              Expression which must be TRUE
+ */
+# define ES_DBG_ASSERT(num, expr)                                               \
+    do {                                                                        \
+        if (!(expr)) {                                                          \
+            userAssert(PORT_C_FUNC, #num, #expr);                               \
+        }                                                                       \
+    } while (0U)
+
+/**@brief       Make sure the caller has fulfilled all contract preconditions
+ */
+# define ES_DBG_API_REQUIRE(num, expr)                                          \
+    ES_DBG_ASSERT(num, expr)
+
+/**@brief       Make sure the callee has fulfilled all contract postconditions
+ */
+# define ES_DBG_API_ENSURE(num, expr)                                           \
+    ES_DBG_ASSERT(num, expr)
+
+/**@brief       Execute code to fulfill the contract
+ */
+# define ES_DBG_API_OBLIGATION(expr)                                            \
+    expr
+#else
+# define ES_DBG_ASSERT(num, expr)       (void)0
+# define ES_DBG_API_REQUIRE(num, expr)  (void)0
+# define ES_DBG_API_ENSURE(num, expr)   (void)0
+# define ES_DBG_API_OBLIGATION(expr)    (void)0
+#endif
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Error codes reported by debug asserts
+ */
+enum esDbgStatus {
+    ES_DBG_NO_ERROR,
+    ES_DBG_OBJECT_NOT_VALID = 0x100UL,                                          /**< @brief Object signature is not valid                   */
+    ES_DBG_OUT_OF_RANGE,                                                        /**< @brief Argument value is out of range                  */
+    ES_DBG_POINTER_NULL,                                                        /**< @brief Pointer is NULL                                 */
+    ES_DBG_NOT_ENOUGH_MEM,                                                      /**< @brief There is not enough memory                      */
+    ES_DBG_USAGE_FAILURE                                                        /**< @brief Object is used in a wrong way                   */
+};
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Called when an assert fails
+ * @param       fnName
+ *              Name of the function where the assert failed
+ * @param       expl
+ *              Error code name
+ * @param       expr
+ *              Expression which failed
+ * @details     The host implementation prints the message and aborts.
+ */
+PORT_C_NORETURN void userAssert(
+    const PORT_C_ROM char * fnName,
+    const PORT_C_ROM char * expl,
+    const PORT_C_ROM char * expr);
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of dbg.h
+ ******************************************************************************/
+#endif /* DBG_H_ */
@@ -0,0 +1,147 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Host implementation of pool and dynamic memory allocators
+ * @addtogroup  host_mem
+ *********************************************************************//** @{ */
+
+#ifndef BASE_MEM_H_
+#define BASE_MEM_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "arch/compiler.h"
+#include "arch/cpu.h"
+
+#if (1U == OPT_MEM_POOL_LOCKFREE)
+# include "primitive/lfpool.h"
+#endif
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Returns the block size of a pool
+ * @param       pool
+ *              Pointer to pool handle
+ */
+#define ES_PMEM_ATTR_BLOCK_SIZE_GET(pool)                                       \
+    ((pool)->blockSize)
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Pool allocator handle
+ */
+typedef struct esPMemHandle {
+    void *          freeList;                                                   /**< @brief First free block                                */
+    size_t          blockSize;                                                  /**< @brief Size of one block in bytes                      */
+    size_t          nFree;                                                      /**< @brief Number of free blocks                           */
+} esPMemHandle_T;
+
+/**@brief       Dynamic allocator handle
+ * @details     The host implementation delegates to the C library, the handle
+ *              only counts live blocks.
+ */
+typedef struct esDMemHandle {
+    size_t          nBlocks;                                                    /**< @brief Number of allocated blocks                      */
+} esDMemHandle_T;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+
+/**@brief       Default dynamic allocator handle
+ */
+extern esDMemHandle_T DefDMemHandle;
+
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/*------------------------------------------------------------------------*//**
+ * @name        Pool allocator
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Initializes pool allocator
+ * @param       handle
+ *              Pointer to pool handle
+ * @param       pool
+ *              Storage for blocks
+ * @param       poolSize
+ *              Size of storage in bytes
+ * @param       blockSize
+ *              Requested block size, rounded up to PORT_DATA_ALIGNMENT
+ */
+void esPMemInit(
+    esPMemHandle_T *    handle,
+    void *              pool,
+    size_t              poolSize,
+    size_t              blockSize);
+
+void * esPMemAllocI(
+    esPMemHandle_T *    handle);
+
+void * esPMemAlloc(
+    esPMemHandle_T *    handle);
+
+void esPMemDeAllocI(
+    esPMemHandle_T *    handle,
+    void *              mem);
+
+void esPMemDeAlloc(
+    esPMemHandle_T *    handle,
+    void *              mem);
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Dynamic allocator
+ * @{ *//*--------------------------------------------------------------------*/
+
+void * esDMemAllocI(
+    esDMemHandle_T *    handle,
+    size_t              size);
+
+void * esDMemAlloc(
+    esDMemHandle_T *    handle,
+    size_t              size);
+
+void esDMemDeAllocI(
+    esDMemHandle_T *    handle,
+    void *              mem);
+
+void esDMemDeAlloc(
+    esDMemHandle_T *    handle,
+    void *              mem);
+
+/** @} *//*-----------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of mem.h
+ ******************************************************************************/
+#endif /* BASE_MEM_H_ */
@@ -0,0 +1,95 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Host implementation of memory classes
+ * @addtogroup  host_mem
+ *********************************************************************//** @{ */
+
+#ifndef EDS_MEM_H_
+#define EDS_MEM_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "arch/compiler.h"
+#include "base/mem.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Memory class, allocator used to create an object
+ * @details     Objects created with a memory class keep a pointer to the class
+ *              in their first word so they can be returned to it.
+ */
+struct memClass {
+    void * (* alloc)(size_t);                                                   /**< @brief Allocator function                              */
+    void   (* deAlloc)(void *);                                                 /**< @brief Deallocator function                            */
+};
+
+/**@brief       Memory class type
+ */
+typedef struct memClass esMemClass_T;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+
+/**@brief       Dynamic memory class
+ */
+extern const PORT_C_ROM esMemClass_T esMemDynClass;
+
+/**@brief       Static memory class
+ */
+extern const PORT_C_ROM esMemClass_T esMemStaticClass;
+
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initializes memory classes
+ */
+void esMemInit(
+    void);
+
+/**@brief       Allocates static memory
+ * @param       size
+ *              Size of the block in bytes
+ * @details     Static memory is never returned.
+ */
+void * esSmemAllocI(
+    size_t          size);
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of mem.h
+ ******************************************************************************/
+#endif /* EDS_MEM_H_ */
@@ -0,0 +1,245 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Host implementation of memory allocators and debug support
+ * @addtogroup  host_mem
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "base/dbg.h"
+#include "base/mem.h"
+#include "eds/mem.h"
+
+/*===============================================================  DEFINES  ==*/
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static void * memDynAlloc(
+    size_t          size);
+
+static void memDynDeAlloc(
+    void *          mem);
+
+static void memStaticDeAlloc(
+    void *          mem);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+/*======================================================  GLOBAL VARIABLES  ==*/
+
+esDMemHandle_T DefDMemHandle;
+
+const PORT_C_ROM esMemClass_T esMemDynClass = {
+    memDynAlloc,
+    memDynDeAlloc
+};
+
+const PORT_C_ROM esMemClass_T esMemStaticClass = {
+    esSmemAllocI,
+    memStaticDeAlloc
+};
+
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static void * memDynAlloc(
+    size_t          size) {
+
+    return (esDMemAlloc(&DefDMemHandle, size));
+}
+
+static void memDynDeAlloc(
+    void *          mem) {
+
+    esDMemDeAlloc(&DefDMemHandle, mem);
+}
+
+static void memStaticDeAlloc(
+    void *          mem) {
+
+    (void)mem;
+
+    ES_DBG_ASSERT(ES_DBG_USAGE_FAILURE, FALSE);                                 /* Staticki objekat se ne moze osloboditi.                  */
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esPMemInit(
+    esPMemHandle_T *    handle,
+    void *              pool,
+    size_t              poolSize,
+    size_t              blockSize) {
+
+    uint8_t *       block;
+    size_t          cnt;
+
+    if (sizeof(void *) > blockSize) {
+        blockSize = sizeof(void *);
+    }
+    blockSize = (blockSize + (PORT_DATA_ALIGNMENT - 1U)) & ~(size_t)(PORT_DATA_ALIGNMENT - 1U);
+    handle->blockSize = blockSize;
+    handle->nFree = poolSize / blockSize;
+    handle->freeList = NULL;
+    block = (uint8_t *)pool + (handle->nFree * blockSize);
+
+    for (cnt = 0U; cnt < handle->nFree; cnt++) {
+        block -= blockSize;
+        *(void **)block = handle->freeList;
+        handle->freeList = block;
+    }
+}
+
+void * esPMemAllocI(
+    esPMemHandle_T *    handle) {
+
+    void *          block;
+
+    block = handle->freeList;
+
+    if (NULL != block) {
+        handle->freeList = *(void **)block;
+        handle->nFree--;
+    }
+
+    return (block);
+}
+
+void * esPMemAlloc(
+    esPMemHandle_T *    handle) {
+
+    void *          block;
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    block = esPMemAllocI(
+        handle);
+    PORT_CRITICAL_EXIT();
+
+    return (block);
+}
+
+void esPMemDeAllocI(
+    esPMemHandle_T *    handle,
+    void *              mem) {
+
+    *(void **)mem = handle->freeList;
+    handle->freeList = mem;
+    handle->nFree++;
+}
+
+void esPMemDeAlloc(
+    esPMemHandle_T *    handle,
+    void *              mem) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    esPMemDeAllocI(
+        handle,
+        mem);
+    PORT_CRITICAL_EXIT();
+}
+
+void * esDMemAllocI(
+    esDMemHandle_T *    handle,
+    size_t              size) {
+
+    void *          mem;
+
+    mem = malloc(size);
+
+    if (NULL != mem) {
+        handle->nBlocks++;
+    }
+
+    return (mem);
+}
+
+void * esDMemAlloc(
+    esDMemHandle_T *    handle,
+    size_t              size) {
+
+    void *          mem;
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    mem = esDMemAllocI(
+        handle,
+        size);
+    PORT_CRITICAL_EXIT();
+
+    return (mem);
+}
+
+void esDMemDeAllocI(
+    esDMemHandle_T *    handle,
+    void *              mem) {
+
+    handle->nBlocks--;
+    free(mem);
+}
+
+void esDMemDeAlloc(
+    esDMemHandle_T *    handle,
+    void *              mem) {
+
+    PORT_CRITICAL_DECL;
+
+    PORT_CRITICAL_ENTER();
+    esDMemDeAllocI(
+        handle,
+        mem);
+    PORT_CRITICAL_EXIT();
+}
+
+void esMemInit(
+    void) {
+
+    DefDMemHandle.nBlocks = 0U;
+}
+
+void * esSmemAllocI(
+    size_t          size) {
+
+    return (malloc(size));
+}
+
+void userAssert(
+    const PORT_C_ROM char * fnName,
+    const PORT_C_ROM char * expl,
+    const PORT_C_ROM char * expr) {
+
+    (void)fprintf(stderr, "ASSERT: %s: %s (%s)\n", fnName, expl, expr);
+    abort();
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of mem.c
+ ******************************************************************************/
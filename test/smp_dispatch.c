@@ -0,0 +1,196 @@
+/*
+ * This file is part of eSolid
+ *
+ * Copyright (C) 2011, 2012 - Nenad Radulovic
+ *
+ * eSolid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with eSolid; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ * web site:    http://blueskynet.dyndns-server.com
+ * e-mail  :    blueskyniss@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Test of the SMP dispatcher
+ * @details     A host thread posts events to EPA objects spread over all
+ *              kernel CPUs. The test fails if an event is lost or if an EPA
+ *              object is ever dispatched on two CPUs at the same time.
+ * @addtogroup  test
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "eds/kernel.h"
+
+/*===============================================================  DEFINES  ==*/
+
+#define EPA_NUM                         16U
+#define EVT_NUM                         20000U
+#define SIG_WORK                        (SIG_ID_USR + 1U)
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+
+struct worker {
+    esEpa_T         epa;
+    atomic_uint     inside;
+    atomic_uint     count;
+};
+
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+static esStatus_T workerState(
+    void *          sm,
+    esEvt_T *       evt);
+
+static void * producer(
+    void *          arg);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static struct worker * Worker[EPA_NUM];
+
+static atomic_uint Overlap;
+
+static atomic_uint Dispatched;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esStatus_T workerState(
+    void *          sm,
+    esEvt_T *       evt) {
+
+    struct worker * worker;
+    esStatus_T      status;
+
+    worker = (struct worker *)sm;
+    status = ES_STATE_IGNORED();
+
+    if (SIG_WORK == evt->id) {
+
+        if (0U != atomic_fetch_add(&worker->inside, 1U)) {
+            atomic_fetch_add(&Overlap, 1U);
+        }
+        sched_yield();                                                          /* Widen the window in which an overlap is seen.            */
+        atomic_fetch_add(&worker->count, 1U);
+        atomic_fetch_sub(&worker->inside, 1U);
+        atomic_fetch_add(&Dispatched, 1U);
+        status = ES_STATE_HANDLED();
+    }
+
+    return (status);
+}
+
+static void * producer(
+    void *          arg) {
+
+    uint32_t        cnt;
+    uint32_t        epaCnt;
+    int             result;
+
+    (void)arg;
+
+    for (cnt = 0U; cnt < EVT_NUM; cnt++) {
+        esEvt_T *   evt;
+
+        evt = esEvtCreate(
+            sizeof(esEvt_T),
+            (esEvtId_T)SIG_WORK);
+
+        while (EVT_POST_OK != esEvtTryPost(&Worker[cnt % EPA_NUM]->epa, evt)) {
+            sched_yield();
+        }
+    }
+
+    while (EVT_NUM != atomic_load(&Dispatched)) {
+        sched_yield();
+    }
+    result = EXIT_SUCCESS;
+
+    for (epaCnt = 0U; epaCnt < EPA_NUM; epaCnt++) {
+
+        if ((EVT_NUM / EPA_NUM) != atomic_load(&Worker[epaCnt]->count)) {
+            (void)printf("EPA %u: dispatched %u events, expected %u\n",
+                epaCnt,
+                atomic_load(&Worker[epaCnt]->count),
+                EVT_NUM / EPA_NUM);
+            result = EXIT_FAILURE;
+        }
+    }
+
+    if (0U != atomic_load(&Overlap)) {
+        (void)printf("EPA objects ran on two CPUs at once %u times\n",
+            atomic_load(&Overlap));
+        result = EXIT_FAILURE;
+    }
+    (void)printf("smp_dispatch: %u CPUs, %u EPAs, %u events: %s\n",
+        (unsigned)OPT_KERNEL_CPU_NUM,
+        EPA_NUM,
+        EVT_NUM,
+        (EXIT_SUCCESS == result) ? "PASS" : "FAIL");
+    exit(result);
+
+    return (NULL);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+int main(
+    void) {
+
+    static const esEpaDef_T definition = {
+        .epaName          = "worker",
+        .epaPrio          = 1U,
+        .epaWorkspaceSize = sizeof(struct worker),
+        .evtQueueLevels   = 64U,
+        .smInitState      = workerState,
+        .smLevels         = 2U,
+        .evtUrgentLevels  = 4U
+    };
+    pthread_t       thread;
+    uint32_t        cnt;
+
+    esKernelInit();
+
+    for (cnt = 0U; cnt < EPA_NUM; cnt++) {
+        esEpaDef_T  def;
+
+        def = definition;
+        def.epaPrio = (uint16_t)(1U + (cnt % 4U));
+        def.epaCpu = (uint8_t)(cnt % OPT_KERNEL_CPU_NUM);
+        Worker[cnt] = (struct worker *)esEpaCreate(
+            &esMemDynClass,
+            &def);
+        atomic_init(&Worker[cnt]->inside, 0U);
+        atomic_init(&Worker[cnt]->count, 0U);
+    }
+    (void)pthread_create(&thread, NULL, producer, NULL);
+    esKernelStart();
+
+    return (EXIT_FAILURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of smp_dispatch.c
+ ******************************************************************************/